@@ -8,7 +8,12 @@
 
 namespace yas::audio {
 class pcm_buffer;
+class pcm_buffer_pool;
+class pcm_ring_buffer;
+class mapped_pcm_buffer;
+class compressed_pcm_buffer;
 class time;
+class timeline_clock;
 class file;
 class io_kernel;
 class io;
@@ -27,6 +32,8 @@ class avf_au_parameter;
 class avf_au_parameter_core;
 class offline_device;
 class offline_io_core;
+class rendering_worker_pool;
+class rendering_graph_holder;
 class graph_connection;
 class graph_kernel;
 class graph;
@@ -49,7 +56,12 @@ class manageable_graph_avf_au;
 class renderable_graph_connection;
 
 using pcm_buffer_ptr = std::shared_ptr<pcm_buffer>;
+using pcm_buffer_pool_ptr = std::shared_ptr<pcm_buffer_pool>;
+using pcm_ring_buffer_ptr = std::shared_ptr<pcm_ring_buffer>;
+using mapped_pcm_buffer_ptr = std::shared_ptr<mapped_pcm_buffer>;
+using compressed_pcm_buffer_ptr = std::shared_ptr<compressed_pcm_buffer>;
 using time_ptr = std::shared_ptr<time>;
+using timeline_clock_ptr = std::shared_ptr<timeline_clock>;
 using file_ptr = std::shared_ptr<file>;
 using io_kernel_ptr = std::shared_ptr<io_kernel>;
 using io_ptr = std::shared_ptr<io>;
@@ -68,6 +80,8 @@ using avf_au_parameter_ptr = std::shared_ptr<avf_au_parameter>;
 using avf_au_parameter_core_ptr = std::shared_ptr<avf_au_parameter_core>;
 using offline_device_ptr = std::shared_ptr<offline_device>;
 using offline_io_core_ptr = std::shared_ptr<offline_io_core>;
+using rendering_worker_pool_ptr = std::shared_ptr<rendering_worker_pool>;
+using rendering_graph_holder_ptr = std::shared_ptr<rendering_graph_holder>;
 using graph_connection_ptr = std::shared_ptr<graph_connection>;
 using graph_kernel_ptr = std::shared_ptr<graph_kernel>;
 using graph_ptr = std::shared_ptr<graph>;
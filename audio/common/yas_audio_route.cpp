@@ -78,3 +78,43 @@ channel_map_result audio::channel_map_from_routes(route_set_t const &routes, uin
 
     return channel_map_result(nullptr);
 }
+
+#pragma mark - route_table
+
+route_table::route_table(route_set_t const &routes, channel_counts_t const &src_ch_counts,
+                         channel_counts_t const &dst_ch_counts)
+    : _src_bus_count(src_ch_counts.empty() ? 0 : src_ch_counts.rbegin()->first + 1),
+      _dst_bus_count(dst_ch_counts.empty() ? 0 : dst_ch_counts.rbegin()->first + 1) {
+    this->_entries.resize(this->_src_bus_count * this->_dst_bus_count);
+
+    for (auto const &[src_bus_idx, src_ch_count] : src_ch_counts) {
+        for (auto const &[dst_bus_idx, dst_ch_count] : dst_ch_counts) {
+            if (auto const result =
+                    channel_map_from_routes(routes, src_bus_idx, src_ch_count, dst_bus_idx, dst_ch_count)) {
+                auto const &channel_map = result.value();
+
+                this->_entries.at(src_bus_idx * this->_dst_bus_count + dst_bus_idx) = {
+                    .offset = static_cast<uint32_t>(this->_channels.size()),
+                    .src_ch_count = src_ch_count,
+                    .dst_ch_count = dst_ch_count};
+
+                this->_channels.insert(this->_channels.end(), channel_map.begin(), channel_map.end());
+            }
+        }
+    }
+}
+
+uint32_t const *route_table::channel_map(uint32_t const src_bus_idx, uint32_t const src_ch_count,
+                                         uint32_t const dst_bus_idx, uint32_t const dst_ch_count) const {
+    if (src_bus_idx >= this->_src_bus_count || dst_bus_idx >= this->_dst_bus_count) {
+        return nullptr;
+    }
+
+    auto const &entry = this->_entries[src_bus_idx * this->_dst_bus_count + dst_bus_idx];
+
+    if (entry.src_ch_count == 0 || entry.src_ch_count != src_ch_count || entry.dst_ch_count != dst_ch_count) {
+        return nullptr;
+    }
+
+    return &this->_channels[entry.offset];
+}
@@ -6,6 +6,7 @@
 
 #include <audio/yas_audio_types.h>
 
+#include <map>
 #include <set>
 
 namespace yas {
@@ -41,4 +42,27 @@ using channel_map_result = result<channel_map_t, std::nullptr_t>;
 channel_map_result channel_map_from_routes(route_set_t const &routes, uint32_t const src_bus_idx,
                                            uint32_t const src_ch_count, uint32_t const dst_bus_idx,
                                            uint32_t const dst_ch_count);
+
+struct route_table final {
+    using channel_counts_t = std::map<uint32_t, uint32_t>;
+
+    route_table() = default;
+    route_table(route_set_t const &routes, channel_counts_t const &src_ch_counts,
+                channel_counts_t const &dst_ch_counts);
+
+    [[nodiscard]] uint32_t const *channel_map(uint32_t const src_bus_idx, uint32_t const src_ch_count,
+                                              uint32_t const dst_bus_idx, uint32_t const dst_ch_count) const;
+
+   private:
+    struct entry {
+        uint32_t offset = 0;
+        uint32_t src_ch_count = 0;
+        uint32_t dst_ch_count = 0;
+    };
+
+    std::size_t _src_bus_count = 0;
+    std::size_t _dst_bus_count = 0;
+    std::vector<entry> _entries;
+    std::vector<uint32_t> _channels;
+};
 }  // namespace yas::audio
@@ -21,14 +21,14 @@ static AudioTimeStamp make_time_stamp_from_host_time(uint64_t const host_time) {
     return timeStamp;
 }
 
-static AudioTimeStamp make_time_stamp_from_sample_time(uint64_t const sample_time) {
+static AudioTimeStamp make_time_stamp_from_sample_time(int64_t const sample_time) {
     AudioTimeStamp timeStamp{0};
     timeStamp.mSampleTime = sample_time;
     timeStamp.mFlags = kAudioTimeStampSampleTimeValid;
     return timeStamp;
 }
 
-static AudioTimeStamp make_time_stamp(uint64_t const host_time, uint64_t const sample_time) {
+static AudioTimeStamp make_time_stamp(uint64_t const host_time, int64_t const sample_time) {
     AudioTimeStamp timeStamp{0};
     timeStamp.mHostTime = host_time;
     timeStamp.mSampleTime = sample_time;
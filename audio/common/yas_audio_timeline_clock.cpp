@@ -0,0 +1,209 @@
+//
+//  yas_audio_timeline_clock.cpp
+//
+
+#include "yas_audio_timeline_clock.h"
+
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+using namespace yas;
+using namespace yas::audio;
+
+namespace yas::audio::timeline_clock_utils {
+static double seconds_between(uint64_t const from_host_time, uint64_t const to_host_time) {
+    if (from_host_time <= to_host_time) {
+        return seconds_for_host_time(to_host_time - from_host_time);
+    } else {
+        return -seconds_for_host_time(from_host_time - to_host_time);
+    }
+}
+
+static uint64_t host_time_offset(uint64_t const host_time, double const seconds) {
+    if (seconds >= 0.0) {
+        return host_time + host_time_for_seconds(seconds);
+    } else {
+        uint64_t const offset = host_time_for_seconds(-seconds);
+        return offset < host_time ? host_time - offset : 0;
+    }
+}
+
+template <typename Estimate>
+static std::optional<uint64_t> host_time_for_sample_time(Estimate const &estimate, int64_t const sample_time,
+                                                         double const sample_rate) {
+    if (!estimate.latest.has_value()) {
+        return std::nullopt;
+    }
+
+    auto const &latest = estimate.latest.value();
+    double const seconds = static_cast<double>(sample_time - latest.sample_time) / (sample_rate * estimate.rate_scalar);
+
+    return host_time_offset(latest.host_time, seconds);
+}
+}  // namespace yas::audio::timeline_clock_utils
+
+timeline_clock::timeline_clock(double const sample_rate) : _sample_rate(sample_rate) {
+    if (sample_rate <= 0.0) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : sample_rate must be greater than 0.");
+    }
+}
+
+double timeline_clock::sample_rate() const {
+    return this->_sample_rate;
+}
+
+int64_t timeline_clock::sample_time() const {
+    return this->_sample_time.load(std::memory_order_relaxed);
+}
+
+audio::time timeline_clock::time() const {
+    int64_t const sample_time = this->sample_time();
+    auto const estimate = this->_load_estimate();
+    auto const host_time = timeline_clock_utils::host_time_for_sample_time(estimate, sample_time, this->_sample_rate);
+
+    if (host_time.has_value()) {
+        AudioTimeStamp time_stamp{0};
+        time_stamp.mSampleTime = static_cast<double>(sample_time);
+        time_stamp.mHostTime = host_time.value();
+        time_stamp.mRateScalar = estimate.rate_scalar;
+        time_stamp.mFlags = kAudioTimeStampSampleHostTimeValid | kAudioTimeStampRateScalarValid;
+        return audio::time{time_stamp, this->_sample_rate};
+    } else {
+        return audio::time{sample_time, this->_sample_rate};
+    }
+}
+
+void timeline_clock::reset(int64_t const sample_time) {
+    this->_sample_time.store(sample_time, std::memory_order_relaxed);
+    this->_store_estimate({});
+}
+
+void timeline_clock::advance(uint32_t const frames) {
+    this->_sample_time.fetch_add(frames, std::memory_order_relaxed);
+}
+
+void timeline_clock::synchronize(uint64_t const host_time, int64_t const sample_time) {
+    this->_sample_time.store(sample_time, std::memory_order_relaxed);
+
+    anchor const current{.host_time = host_time, .sample_time = sample_time};
+    auto estimate = this->_load_estimate();
+
+    if (!estimate.origin.has_value() || !estimate.latest.has_value() || host_time <= estimate.latest->host_time ||
+        sample_time < estimate.latest->sample_time) {
+        // a first observation or a discontinuity restarts the estimation
+        this->_store_estimate({.origin = current, .latest = current, .rate_scalar = 1.0});
+        return;
+    }
+
+    estimate.latest = current;
+
+    auto const &origin = estimate.origin.value();
+    double const elapsed = timeline_clock_utils::seconds_between(origin.host_time, host_time);
+    if (elapsed > 0.0 && sample_time > origin.sample_time) {
+        estimate.rate_scalar = static_cast<double>(sample_time - origin.sample_time) / (elapsed * this->_sample_rate);
+    }
+
+    this->_store_estimate(estimate);
+}
+
+void timeline_clock::synchronize(audio::time const &time) {
+    uint32_t const flags = time.audio_time_stamp().mFlags;
+
+    if ((flags & kAudioTimeStampSampleHostTimeValid) == kAudioTimeStampSampleHostTimeValid) {
+        this->synchronize(time.host_time(), time.sample_time());
+    } else if (flags & kAudioTimeStampSampleTimeValid) {
+        this->_sample_time.store(time.sample_time(), std::memory_order_relaxed);
+    }
+}
+
+bool timeline_clock::is_synchronized() const {
+    return this->_load_estimate().latest.has_value();
+}
+
+double timeline_clock::rate_scalar() const {
+    return this->_load_estimate().rate_scalar;
+}
+
+double timeline_clock::drift_samples() const {
+    auto const estimate = this->_load_estimate();
+
+    if (!estimate.origin.has_value() || !estimate.latest.has_value()) {
+        return 0.0;
+    }
+
+    auto const &origin = estimate.origin.value();
+    auto const &latest = estimate.latest.value();
+    double const elapsed = timeline_clock_utils::seconds_between(origin.host_time, latest.host_time);
+
+    return static_cast<double>(latest.sample_time - origin.sample_time) - elapsed * this->_sample_rate;
+}
+
+std::optional<uint64_t> timeline_clock::host_time_for_sample_time(int64_t const sample_time) const {
+    return timeline_clock_utils::host_time_for_sample_time(this->_load_estimate(), sample_time, this->_sample_rate);
+}
+
+std::optional<int64_t> timeline_clock::sample_time_for_host_time(uint64_t const host_time) const {
+    auto const estimate = this->_load_estimate();
+
+    if (!estimate.latest.has_value()) {
+        return std::nullopt;
+    }
+
+    auto const &latest = estimate.latest.value();
+    double const seconds = timeline_clock_utils::seconds_between(latest.host_time, host_time);
+
+    return latest.sample_time + std::llround(seconds * this->_sample_rate * estimate.rate_scalar);
+}
+
+timeline_clock::estimate timeline_clock::_load_estimate() const {
+    while (true) {
+        uint64_t const sequence = this->_sequence.load(std::memory_order_acquire);
+
+        if (sequence % 2 != 0) {
+            continue;
+        }
+
+        estimate result;
+
+        if (this->_is_synchronized.load(std::memory_order_relaxed)) {
+            result.origin = anchor{.host_time = this->_origin_host_time.load(std::memory_order_relaxed),
+                                   .sample_time = this->_origin_sample_time.load(std::memory_order_relaxed)};
+            result.latest = anchor{.host_time = this->_latest_host_time.load(std::memory_order_relaxed),
+                                   .sample_time = this->_latest_sample_time.load(std::memory_order_relaxed)};
+        }
+
+        result.rate_scalar = this->_rate_scalar.load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if (this->_sequence.load(std::memory_order_relaxed) == sequence) {
+            return result;
+        }
+    }
+}
+
+void timeline_clock::_store_estimate(estimate const &estimate) {
+    uint64_t const sequence = this->_sequence.load(std::memory_order_relaxed);
+
+    this->_sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    // origin and latest are always set and cleared together
+    this->_is_synchronized.store(estimate.latest.has_value(), std::memory_order_relaxed);
+
+    if (estimate.origin.has_value() && estimate.latest.has_value()) {
+        this->_origin_host_time.store(estimate.origin->host_time, std::memory_order_relaxed);
+        this->_origin_sample_time.store(estimate.origin->sample_time, std::memory_order_relaxed);
+        this->_latest_host_time.store(estimate.latest->host_time, std::memory_order_relaxed);
+        this->_latest_sample_time.store(estimate.latest->sample_time, std::memory_order_relaxed);
+    }
+
+    this->_rate_scalar.store(estimate.rate_scalar, std::memory_order_relaxed);
+
+    this->_sequence.store(sequence + 2, std::memory_order_release);
+}
+
+timeline_clock_ptr timeline_clock::make_shared(double const sample_rate) {
+    return timeline_clock_ptr(new timeline_clock{sample_rate});
+}
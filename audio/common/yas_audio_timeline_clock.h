@@ -0,0 +1,70 @@
+//
+//  yas_audio_timeline_clock.h
+//
+
+#pragma once
+
+#include <audio/yas_audio_ptr.h>
+#include <audio/yas_audio_time.h>
+
+#include <atomic>
+#include <optional>
+
+namespace yas::audio {
+// reset, advance and synchronize are called from one thread at a time, usually the render thread.
+// the other functions can be called from any thread
+struct timeline_clock final {
+    [[nodiscard]] double sample_rate() const;
+    [[nodiscard]] int64_t sample_time() const;
+    [[nodiscard]] audio::time time() const;
+
+    void reset(int64_t const sample_time = 0);
+    void advance(uint32_t const frames);
+
+    void synchronize(uint64_t const host_time, int64_t const sample_time);
+    void synchronize(audio::time const &);
+
+    [[nodiscard]] bool is_synchronized() const;
+    [[nodiscard]] double rate_scalar() const;
+    [[nodiscard]] double drift_samples() const;
+
+    [[nodiscard]] std::optional<uint64_t> host_time_for_sample_time(int64_t const) const;
+    [[nodiscard]] std::optional<int64_t> sample_time_for_host_time(uint64_t const) const;
+
+    [[nodiscard]] static timeline_clock_ptr make_shared(double const sample_rate);
+
+   private:
+    struct anchor {
+        uint64_t host_time;
+        int64_t sample_time;
+    };
+
+    struct estimate {
+        std::optional<anchor> origin = std::nullopt;
+        std::optional<anchor> latest = std::nullopt;
+        double rate_scalar = 1.0;
+    };
+
+    double const _sample_rate;
+    std::atomic<int64_t> _sample_time = 0;
+
+    // the estimate is published as one snapshot through a seqlock. an odd sequence means a write is in progress
+    std::atomic<uint64_t> _sequence = 0;
+    std::atomic<bool> _is_synchronized = false;
+    std::atomic<uint64_t> _origin_host_time = 0;
+    std::atomic<int64_t> _origin_sample_time = 0;
+    std::atomic<uint64_t> _latest_host_time = 0;
+    std::atomic<int64_t> _latest_sample_time = 0;
+    std::atomic<double> _rate_scalar = 1.0;
+
+    explicit timeline_clock(double const sample_rate);
+
+    [[nodiscard]] estimate _load_estimate() const;
+    void _store_estimate(estimate const &);
+
+    timeline_clock(timeline_clock const &) = delete;
+    timeline_clock(timeline_clock &&) = delete;
+    timeline_clock &operator=(timeline_clock const &) = delete;
+    timeline_clock &operator=(timeline_clock &&) = delete;
+};
+}  // namespace yas::audio
@@ -23,6 +23,10 @@ std::string yas::to_string(pcm_format const &pcm_format) {
             return "Int16";
         case pcm_format::fixed824:
             return "Fixed8.24";
+        case pcm_format::int24:
+            return "Int24";
+        case pcm_format::float16:
+            return "Float16";
         case pcm_format::other:
             return "Other";
     }
@@ -38,6 +42,10 @@ std::type_info const &yas::to_sample_type(pcm_format const &pcm_format) {
             return typeid(int16_t);
         case pcm_format::fixed824:
             return typeid(int32_t);
+        case pcm_format::int24:
+            return typeid(audio::int24_t);
+        case pcm_format::float16:
+            return typeid(audio::float16_t);
         case pcm_format::other:
             return typeid(std::nullptr_t);
     }
@@ -88,6 +96,15 @@ std::string yas::to_string(audio::render_type const &type) {
     }
 }
 
+std::string yas::to_string(audio::memory_policy const &policy) {
+    switch (policy) {
+        case audio::memory_policy::standard:
+            return "standard";
+        case audio::memory_policy::locked:
+            return "locked";
+    }
+}
+
 std::string yas::to_string(OSStatus const err) {
     switch (err) {
         case noErr:
@@ -169,3 +186,8 @@ std::ostream &operator<<(std::ostream &os, yas::audio::render_type const &value)
     os << to_string(value);
     return os;
 }
+
+std::ostream &operator<<(std::ostream &os, yas::audio::memory_policy const &value) {
+    os << to_string(value);
+    return os;
+}
@@ -6,10 +6,12 @@
 
 #include <AudioUnit/AUComponent.h>
 
+#include <functional>
 #include <memory>
 #include <optional>
 #include <ostream>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 namespace yas::audio {
@@ -19,6 +21,8 @@ enum class pcm_format : uint32_t {
     float64,
     int16,
     fixed824,
+    int24,
+    float16,
 };
 
 enum class render_type : uint32_t {
@@ -38,10 +42,48 @@ enum class continuation {
     keep,
 };
 
+enum class memory_policy {
+    standard,
+    locked,
+};
+
+struct int24_t final {
+    uint8_t bytes[3];
+};
+
+struct float16_t final {
+    uint16_t bits;
+};
+
+static_assert(sizeof(int24_t) == 3);
+static_assert(sizeof(float16_t) == 2);
+
+// buffer count that views and each data hold inline without allocating
+static uint32_t constexpr inline_buffer_capacity = 64;
+
 using bus_result_t = std::optional<uint32_t>;
 using abl_uptr = std::unique_ptr<AudioBufferList, std::function<void(AudioBufferList *)>>;
-using abl_data_uptr = std::unique_ptr<std::vector<std::vector<uint8_t>>>;
+using abl_data_uptr = std::unique_ptr<uint8_t, std::function<void(uint8_t *)>>;
 using channel_map_t = std::vector<uint32_t>;
+
+template <typename T>
+constexpr pcm_format pcm_format_of() {
+    if constexpr (std::is_same_v<T, float>) {
+        return pcm_format::float32;
+    } else if constexpr (std::is_same_v<T, double>) {
+        return pcm_format::float64;
+    } else if constexpr (std::is_same_v<T, int16_t>) {
+        return pcm_format::int16;
+    } else if constexpr (std::is_same_v<T, int32_t>) {
+        return pcm_format::fixed824;
+    } else if constexpr (std::is_same_v<T, int24_t>) {
+        return pcm_format::int24;
+    } else if constexpr (std::is_same_v<T, float16_t>) {
+        return pcm_format::float16;
+    } else {
+        return pcm_format::other;
+    }
+}
 }  // namespace yas::audio
 
 namespace yas {
@@ -51,9 +93,11 @@ std::type_info const &to_sample_type(audio::pcm_format const &);
 std::string to_string(audio::direction const &);
 std::string to_string(AudioUnitScope const scope);
 std::string to_string(audio::render_type const &);
+std::string to_string(audio::memory_policy const &);
 std::string to_string(OSStatus const err);
 }  // namespace yas
 
 std::ostream &operator<<(std::ostream &, yas::audio::pcm_format const &);
 std::ostream &operator<<(std::ostream &, yas::audio::direction const &);
 std::ostream &operator<<(std::ostream &, yas::audio::render_type const &);
+std::ostream &operator<<(std::ostream &, yas::audio::memory_policy const &);
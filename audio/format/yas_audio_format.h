@@ -35,6 +35,7 @@ struct format final {
     [[nodiscard]] uint32_t sample_byte_count() const;
     [[nodiscard]] uint32_t frame_byte_count() const;
     [[nodiscard]] CFStringRef description() const;
+    [[nodiscard]] uint32_t id() const;
 
     bool operator==(format const &) const;
     bool operator!=(format const &) const;
@@ -43,6 +44,7 @@ struct format final {
     AudioStreamBasicDescription _asbd = {0};
     audio::pcm_format _pcm_format = audio::pcm_format::other;
     bool _standard = false;
+    uint32_t _id = 0;
 };
 }  // namespace yas::audio
 
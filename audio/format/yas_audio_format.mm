@@ -8,6 +8,7 @@
 #include <cpp_utils/yas_stl_utils.h>
 #include <unordered_map>
 #include "yas_audio_exception.h"
+#include "yas_audio_format_registry.h"
 
 using namespace yas;
 using namespace yas::audio;
@@ -36,6 +37,7 @@ static AudioStreamBasicDescription const empty_asbd = {0};
 
 format::format(AudioStreamBasicDescription asbd) : _asbd(std::move(asbd)) {
     this->_asbd.mReserved = 0;
+    this->_id = format_registry::intern(this->_asbd);
 
     if (asbd.mFormatID == kAudioFormatLinearPCM) {
         if ((asbd.mFormatFlags & kAudioFormatFlagIsFloat) &&
@@ -48,6 +50,8 @@ format::format(AudioStreamBasicDescription asbd) : _asbd(std::move(asbd)) {
                 if (asbd.mFormatFlags & kAudioFormatFlagIsNonInterleaved) {
                     this->_standard = true;
                 }
+            } else if (asbd.mBitsPerChannel == 16) {
+                this->_pcm_format = pcm_format::float16;
             }
         } else if ((asbd.mFormatFlags & kAudioFormatFlagIsSignedInteger) &&
                    ((asbd.mFormatFlags & kAudioFormatFlagIsBigEndian) == kAudioFormatFlagsNativeEndian) &&
@@ -56,6 +60,8 @@ format::format(AudioStreamBasicDescription asbd) : _asbd(std::move(asbd)) {
                                 kLinearPCMFormatFlagsSampleFractionShift;
             if (asbd.mBitsPerChannel == 32 && fraction == 24) {
                 this->_pcm_format = pcm_format::fixed824;
+            } else if (asbd.mBitsPerChannel == 24 && fraction == 0) {
+                this->_pcm_format = pcm_format::int24;
             } else if (asbd.mBitsPerChannel == 16) {
                 this->_pcm_format = pcm_format::int16;
             }
@@ -115,7 +121,10 @@ uint32_t format::sample_byte_count() const {
         case pcm_format::float32:
         case pcm_format::fixed824:
             return 4;
+        case pcm_format::int24:
+            return 3;
         case pcm_format::int16:
+        case pcm_format::float16:
             return 2;
         case pcm_format::float64:
             return 8;
@@ -132,8 +141,12 @@ CFStringRef format::description() const {
     return to_cf_object(to_string(*this));
 }
 
+uint32_t format::id() const {
+    return this->_id;
+}
+
 bool format::operator==(format const &rhs) const {
-    return yas::is_equal(this->_asbd, rhs._asbd);
+    return this->_id == rhs._id;
 }
 
 bool format::operator!=(format const &rhs) const {
@@ -231,9 +244,9 @@ AudioStreamBasicDescription yas::to_stream_description(double const sample_rate,
 
     asbd.mFormatFlags = kAudioFormatFlagsNativeEndian | kAudioFormatFlagIsPacked;
 
-    if (pcm_format == pcm_format::float32 || pcm_format == pcm_format::float64) {
+    if (pcm_format == pcm_format::float32 || pcm_format == pcm_format::float64 || pcm_format == pcm_format::float16) {
         asbd.mFormatFlags |= kAudioFormatFlagIsFloat;
-    } else if (pcm_format == pcm_format::int16) {
+    } else if (pcm_format == pcm_format::int16 || pcm_format == pcm_format::int24) {
         asbd.mFormatFlags |= kAudioFormatFlagIsSignedInteger;
     } else if (pcm_format == pcm_format::fixed824) {
         asbd.mFormatFlags |= kAudioFormatFlagIsSignedInteger | (24 << kLinearPCMFormatFlagsSampleFractionShift);
@@ -245,8 +258,10 @@ AudioStreamBasicDescription yas::to_stream_description(double const sample_rate,
 
     if (pcm_format == pcm_format::float64) {
         asbd.mBitsPerChannel = 64;
-    } else if (pcm_format == pcm_format::int16) {
+    } else if (pcm_format == pcm_format::int16 || pcm_format == pcm_format::float16) {
         asbd.mBitsPerChannel = 16;
+    } else if (pcm_format == pcm_format::int24) {
+        asbd.mBitsPerChannel = 24;
     } else {
         asbd.mBitsPerChannel = 32;
     }
@@ -0,0 +1,42 @@
+//
+//  yas_audio_format_registry.cpp
+//
+
+#include "yas_audio_format_registry.h"
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+using namespace yas;
+
+namespace yas::audio::format_registry_utils {
+struct registry {
+    std::mutex mutex;
+    std::unordered_map<std::string, uint32_t> ids;
+};
+
+static registry &shared_registry() {
+    static registry _registry;
+    return _registry;
+}
+}  // namespace yas::audio::format_registry_utils
+
+uint32_t audio::format_registry::intern(AudioStreamBasicDescription const &asbd) {
+    auto &registry = format_registry_utils::shared_registry();
+    std::string key(reinterpret_cast<char const *>(&asbd), sizeof(AudioStreamBasicDescription));
+
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    auto const [iterator, inserted] =
+        registry.ids.emplace(std::move(key), static_cast<uint32_t>(registry.ids.size()));
+    return iterator->second;
+}
+
+std::size_t audio::format_registry::count() {
+    auto &registry = format_registry_utils::shared_registry();
+
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    return registry.ids.size();
+}
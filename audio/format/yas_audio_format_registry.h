@@ -0,0 +1,15 @@
+//
+//  yas_audio_format_registry.h
+//
+
+#pragma once
+
+#include <AudioToolbox/AudioToolbox.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace yas::audio::format_registry {
+[[nodiscard]] uint32_t intern(AudioStreamBasicDescription const &);
+[[nodiscard]] std::size_t count();
+}  // namespace yas::audio::format_registry
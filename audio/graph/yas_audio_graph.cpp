@@ -85,8 +85,8 @@ void graph::disconnect(graph_connection_ptr const &connection) {
 
     this->_connections.erase(connection);
 
-    if (this->is_running() && this->_io.has_value()) {
-        audio::manageable_graph_io::cast(this->_io.value())->update_rendering();
+    if (this->is_running()) {
+        this->_update_io_rendering();
     }
 }
 
@@ -121,7 +121,7 @@ void graph::disconnect_output(audio::graph_node_ptr const &node, uint32_t const
 audio::graph_io_ptr const &graph::add_io(std::optional<io_device_ptr> const &device) {
     if (!this->_io) {
         audio::io_ptr const raw_io = audio::io::make_shared(device);
-        audio::graph_io_ptr const io = audio::graph_io::make_shared(raw_io);
+        audio::graph_io_ptr const io = audio::graph_io::make_shared(raw_io, this->_buffer_pool);
 
         this->_io_canceller = raw_io->observe_running([this](auto const &method) {
             switch (method) {
@@ -177,6 +177,10 @@ bool graph::is_running() const {
     }
 }
 
+pcm_buffer_pool_ptr const &graph::buffer_pool() const {
+    return this->_buffer_pool;
+}
+
 audio::graph_node_set const &graph::nodes() const {
     return this->_nodes;
 }
@@ -200,8 +204,11 @@ void graph::_attach_node(audio::graph_node_ptr const &node) {
 
     this->_nodes.insert(node);
 
-    manageable_graph_node::cast(node)->set_update_rendering_handler([this] {
+    manageable_graph_node::cast(node)->set_update_rendering_handler([this, weak_node = to_weak(node)] {
         if (this->is_running()) {
+            if (auto const shared_node = weak_node.lock()) {
+                this->_dirty_nodes.insert(shared_node);
+            }
             this->_update_io_rendering();
         }
     });
@@ -344,14 +351,18 @@ audio::graph_connection_set graph::_output_connections_for_source_node(audio::gr
 
 void graph::_update_io_rendering() {
     if (this->_io.has_value()) {
-        audio::manageable_graph_io::cast(this->_io.value())->update_rendering();
+        audio::manageable_graph_io::cast(this->_io.value())->update_rendering(this->_dirty_nodes);
     }
+
+    this->_dirty_nodes.clear();
 }
 
 void graph::_clear_io_rendering() {
     if (this->_io.has_value()) {
         audio::manageable_graph_io::cast(this->_io.value())->clear_rendering();
     }
+
+    this->_dirty_nodes.clear();
 }
 
 audio::graph_ptr graph::make_shared() {
@@ -6,6 +6,7 @@
 
 #include <audio/yas_audio_graph_connection.h>
 #include <audio/yas_audio_graph_node.h>
+#include <audio/yas_audio_pcm_buffer_pool.h>
 
 #include <ostream>
 
@@ -47,6 +48,9 @@ struct graph final {
     void stop();
     [[nodiscard]] bool is_running() const;
 
+    // holds the slot buffers of the rendering graph and the scratch buffers that nodes reserve for themselves
+    [[nodiscard]] pcm_buffer_pool_ptr const &buffer_pool() const;
+
     [[nodiscard]] static graph_ptr make_shared();
 
     // for Test
@@ -59,6 +63,8 @@ struct graph final {
 
     graph_node_set _nodes;
     graph_connection_set _connections;
+    graph_node_set _dirty_nodes;
+    pcm_buffer_pool_ptr const _buffer_pool = pcm_buffer_pool::make_shared();
 
     graph();
 
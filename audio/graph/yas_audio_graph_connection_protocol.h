@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <audio/yas_audio_format.h>
 #include <audio/yas_audio_ptr.h>
 
 #include <map>
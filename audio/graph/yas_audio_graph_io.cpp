@@ -11,6 +11,7 @@
 #include "yas_audio_io.h"
 #include "yas_audio_rendering_connection.h"
 #include "yas_audio_rendering_graph.h"
+#include "yas_audio_rendering_graph_holder.h"
 #include "yas_audio_time.h"
 
 using namespace yas;
@@ -26,11 +27,13 @@ struct graph_input_context {
 
 #pragma mark - graph_io
 
-graph_io::graph_io(io_ptr const &raw_io)
+graph_io::graph_io(io_ptr const &raw_io, pcm_buffer_pool_ptr const &buffer_pool)
     : output_node(graph_node::make_shared({.input_bus_count = 1, .output_bus_count = 0})),
       input_node(graph_node::make_shared({.input_bus_count = 0, .output_bus_count = 1})),
       _raw_io(raw_io),
-      _input_context(std::make_shared<graph_input_context>()) {
+      _input_context(std::make_shared<graph_input_context>()),
+      _rendering_graph_holder(rendering_graph_holder::make_shared()),
+      _buffer_pool(buffer_pool) {
     this->input_node->set_render_handler([input_context = this->_input_context](node_render_args const &args) {
         auto const &buffer = args.buffer;
         auto const *input_buffer = input_context->input_buffer;
@@ -40,6 +43,13 @@ graph_io::graph_io(io_ptr const &raw_io)
             }
         }
     });
+
+    this->_maximum_frames_canceller = raw_io->observe_maximum_frames_per_slice([this](uint32_t const &) {
+        if (this->_is_render_handler_set) {
+            // rebuild the slots with the new capacity. the nodes are reused as they are
+            this->update_rendering({});
+        }
+    });
 }
 
 graph_io::~graph_io() = default;
@@ -48,6 +58,22 @@ io_ptr const &graph_io::raw_io() {
     return this->_raw_io;
 }
 
+void graph_io::set_rendering_worker_pool(rendering_worker_pool_ptr const &worker_pool) {
+    this->_rendering_worker_pool = worker_pool;
+}
+
+rendering_worker_pool_ptr const &graph_io::rendering_worker_pool() const {
+    return this->_rendering_worker_pool;
+}
+
+rendering_graph_holder_ptr const &graph_io::rendering_graph_holder() const {
+    return this->_rendering_graph_holder;
+}
+
+pcm_buffer_pool_ptr const &graph_io::buffer_pool() const {
+    return this->_buffer_pool;
+}
+
 bool graph_io::_validate_connections() {
     auto const &raw_io = this->_raw_io;
 
@@ -112,17 +138,50 @@ bool graph_io::_validate_connections() {
     return true;
 }
 
-void graph_io::update_rendering() {
+void graph_io::update_rendering(graph_node_set const &dirty_nodes) {
     auto const &raw_io = this->_raw_io;
 
-    if (!this->_validate_connections()) {
-        raw_io->set_render_handler(std::nullopt);
+    if (this->_validate_connections()) {
+        uint32_t const maximum_frames = raw_io->maximum_frames_per_slice();
+        std::shared_ptr<rendering_graph> graph = nullptr;
+
+        if (auto const &previous = this->_rendering_graph_holder->graph()) {
+            renderable_graph_node_raw_set raw_dirty_nodes;
+            for (auto const &node : dirty_nodes) {
+                raw_dirty_nodes.insert(node.get());
+            }
+
+            graph = std::make_shared<rendering_graph>(this->output_node, this->input_node, maximum_frames,
+                                                      this->_rendering_worker_pool, *previous, raw_dirty_nodes);
+        } else {
+            graph = std::make_shared<rendering_graph>(this->output_node, this->input_node, maximum_frames,
+                                                      this->_rendering_worker_pool, this->_buffer_pool);
+        }
+
+        auto const &info = graph->build_info();
+        yas_audio_log("graph_io update_rendering - rebuilt " + std::to_string(info.rebuilt_node_count) + " of " +
+                      std::to_string(info.node_count) + " nodes in " + std::to_string(info.duration * 1000.0) +
+                      " ms");
+
+        this->_rendering_graph_holder->set_graph(graph);
+    } else {
+        this->_rendering_graph_holder->set_graph(nullptr);
+    }
+
+    if (this->_is_render_handler_set) {
+        // the running render handler picks up the new graph without restarting the device
         return;
     }
 
-    auto graph = std::make_shared<rendering_graph>(this->output_node, this->input_node);
+    auto render_handler = [input_context = this->_input_context,
+                           holder = this->_rendering_graph_holder](io_render_args args) {
+        rendering_graph_holder::reading const reading{*holder};
+        rendering_graph const *const graph = reading.graph();
+
+        if (!graph) {
+            return;
+        }
 
-    auto render_handler = [input_context = this->_input_context, graph](io_render_args args) {
         input_context->input_buffer = args.input_buffer;
 
         if (pcm_buffer *const buffer = args.output_buffer) {
@@ -136,7 +195,7 @@ void graph_io::update_rendering() {
         if (pcm_buffer *const buffer = args.input_buffer) {
             if (rendering_input_node const *const node = graph->input_node()) {
                 if (auto const &time = args.input_time) {
-                    graph->input_node()->render(buffer, time.value());
+                    node->render(buffer, time.value());
                 }
             }
         }
@@ -145,13 +204,16 @@ void graph_io::update_rendering() {
     };
 
     raw_io->set_render_handler(std::move(render_handler));
+    this->_is_render_handler_set = true;
 }
 
 void graph_io::clear_rendering() {
     auto const &raw_io = this->_raw_io;
     raw_io->set_render_handler(std::nullopt);
+    this->_is_render_handler_set = false;
+    this->_rendering_graph_holder->set_graph(nullptr);
 }
 
-graph_io_ptr graph_io::make_shared(io_ptr const &raw_io) {
-    return graph_io_ptr(new graph_io{raw_io});
+graph_io_ptr graph_io::make_shared(io_ptr const &raw_io, pcm_buffer_pool_ptr const &buffer_pool) {
+    return graph_io_ptr(new graph_io{raw_io, buffer_pool});
 }
@@ -7,6 +7,7 @@
 #include <audio/yas_audio_graph_io_protocol.h>
 #include <audio/yas_audio_graph_node.h>
 #include <audio/yas_audio_io_device.h>
+#include <audio/yas_audio_pcm_buffer_pool.h>
 #include <audio/yas_audio_ptr.h>
 
 namespace yas::audio {
@@ -20,13 +21,25 @@ struct graph_io : manageable_graph_io {
 
     [[nodiscard]] audio::io_ptr const &raw_io() override;
 
-    [[nodiscard]] static graph_io_ptr make_shared(audio::io_ptr const &);
+    void set_rendering_worker_pool(audio::rendering_worker_pool_ptr const &);
+    [[nodiscard]] audio::rendering_worker_pool_ptr const &rendering_worker_pool() const;
+
+    [[nodiscard]] audio::rendering_graph_holder_ptr const &rendering_graph_holder() const;
+    [[nodiscard]] audio::pcm_buffer_pool_ptr const &buffer_pool() const;
+
+    [[nodiscard]] static graph_io_ptr make_shared(audio::io_ptr const &,
+                                                  audio::pcm_buffer_pool_ptr const & = pcm_buffer_pool::make_shared());
 
    private:
     audio::io_ptr const _raw_io;
     std::shared_ptr<graph_input_context> _input_context = nullptr;
+    audio::rendering_worker_pool_ptr _rendering_worker_pool = nullptr;
+    audio::rendering_graph_holder_ptr const _rendering_graph_holder;
+    audio::pcm_buffer_pool_ptr const _buffer_pool;
+    bool _is_render_handler_set = false;
+    observing::canceller_ptr _maximum_frames_canceller = nullptr;
 
-    graph_io(audio::io_ptr const &);
+    graph_io(audio::io_ptr const &, audio::pcm_buffer_pool_ptr const &);
 
     graph_io(graph_io &&) = delete;
     graph_io &operator=(graph_io &&) = delete;
@@ -36,7 +49,7 @@ struct graph_io : manageable_graph_io {
     void _prepare(graph_io_ptr const &);
     bool _validate_connections();
 
-    void update_rendering() override;
+    void update_rendering(graph_node_set const &dirty_nodes) override;
     void clear_rendering() override;
 };
 }  // namespace yas::audio
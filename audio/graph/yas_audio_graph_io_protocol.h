@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <audio/yas_audio_graph_node_protocol.h>
 #include <audio/yas_audio_ptr.h>
 
 namespace yas::audio {
@@ -12,7 +13,7 @@ struct manageable_graph_io {
 
     virtual audio::io_ptr const &raw_io() = 0;
 
-    virtual void update_rendering() = 0;
+    virtual void update_rendering(graph_node_set const &dirty_nodes) = 0;
     virtual void clear_rendering() = 0;
 
     static manageable_graph_io_ptr cast(manageable_graph_io_ptr const &io) {
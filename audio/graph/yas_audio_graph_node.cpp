@@ -20,6 +20,7 @@ graph_node::graph_node(graph_node_args &&args)
     : _input_bus_count(args.input_bus_count),
       _output_bus_count(args.output_bus_count),
       _is_input_renderable(args.input_renderable),
+      _is_input_prerenderable(args.input_prerenderable),
       _override_output_bus_idx(args.override_output_bus_idx) {
 }
 
@@ -124,6 +125,10 @@ bool graph_node::is_input_renderable() const {
     return this->_is_input_renderable;
 }
 
+bool graph_node::is_input_prerenderable() const {
+    return this->_is_input_prerenderable;
+}
+
 void graph_node::set_render_handler(node_render_f handler) {
     this->_render_handler = std::move(handler);
 }
@@ -41,6 +41,7 @@ struct graph_node : connectable_graph_node, manageable_graph_node, renderable_gr
     [[nodiscard]] uint32_t input_bus_count() const;
     [[nodiscard]] uint32_t output_bus_count() const;
     [[nodiscard]] bool is_input_renderable() const override;
+    [[nodiscard]] bool is_input_prerenderable() const override;
 
     void set_render_handler(node_render_f);
     [[nodiscard]] node_render_f const render_handler() const override;
@@ -52,6 +53,7 @@ struct graph_node : connectable_graph_node, manageable_graph_node, renderable_gr
     uint32_t _input_bus_count = 0;
     uint32_t _output_bus_count = 0;
     bool _is_input_renderable = false;
+    bool _is_input_prerenderable = false;
     std::optional<uint32_t> _override_output_bus_idx = std::nullopt;
     audio::graph_connection_wmap _input_connections;
     audio::graph_connection_wmap _output_connections;
@@ -20,6 +20,9 @@ struct graph_node_args {
     uint32_t output_bus_count = 0;
     std::optional<uint32_t> override_output_bus_idx;
     bool input_renderable = false;
+    // true only for a node that always pulls every input with its own frame length and time.
+    // the sources of such a node are rendered ahead by the plan, the others are pulled on demand
+    bool input_prerenderable = false;
 };
 
 struct connectable_graph_node {
@@ -61,6 +64,7 @@ struct renderable_graph_node {
     virtual graph_connection_wmap const &input_connections() const = 0;
     virtual graph_connection_wmap const &output_connections() const = 0;
     virtual bool is_input_renderable() const = 0;
+    virtual bool is_input_prerenderable() const = 0;
     virtual node_render_f const render_handler() const = 0;
 
     static renderable_graph_node_ptr cast(renderable_graph_node_ptr const &node) {
@@ -8,11 +8,28 @@
 #include <cpp_utils/yas_stl_utils.h>
 
 #include "yas_audio_graph_node.h"
+#include "yas_audio_pcm_buffer_view.h"
 #include "yas_audio_rendering_connection.h"
 
 using namespace yas;
 using namespace yas::audio;
 
+#pragma mark - utils
+
+namespace yas::audio::graph_route_utils {
+static route_table::channel_counts_t channel_counts(graph_connection_wmap const &connections) {
+    route_table::channel_counts_t counts;
+
+    for (auto const &pair : connections) {
+        if (auto const connection = pair.second.lock()) {
+            counts.emplace(pair.first, connection->format().channel_count());
+        }
+    }
+
+    return counts;
+}
+}  // namespace yas::audio::graph_route_utils
+
 #pragma mark - main
 
 graph_route::graph_route()
@@ -21,7 +38,10 @@ graph_route::graph_route()
     auto const manageable_node = manageable_graph_node::cast(this->node);
 
     manageable_node->set_prepare_rendering_handler([this] {
-        this->node->set_render_handler([routes = this->_routes](node_render_args const &args) {
+        route_table table{this->_routes, graph_route_utils::channel_counts(this->node->input_connections()),
+                          graph_route_utils::channel_counts(this->node->output_connections())};
+
+        this->node->set_render_handler([table = std::move(table)](node_render_args const &args) {
             auto &dst_buffer = args.buffer;
             auto const dst_bus_idx = args.bus_idx;
             uint32_t const dst_ch_count = dst_buffer->format().channel_count();
@@ -32,11 +52,18 @@ graph_route::graph_route()
                     auto const &src_format = src_connection.format;
                     auto const &src_bus_idx = pair.first;
                     uint32_t const src_ch_count = src_format.channel_count();
-                    if (auto const result =
-                            channel_map_from_routes(routes, src_bus_idx, src_ch_count, dst_bus_idx, dst_ch_count)) {
-                        pcm_buffer src_buffer(src_format, *dst_buffer, result.value());
-
-                        src_connection.render(&src_buffer, args.time);
+                    if (uint32_t const *const channel_map =
+                            table.channel_map(src_bus_idx, src_ch_count, dst_bus_idx, dst_ch_count)) {
+                        if (pcm_buffer_view::is_available(src_format)) {
+                            pcm_buffer_view src_view(src_format, *dst_buffer, channel_map);
+
+                            src_connection.render(&src_view.buffer(), args.time);
+                        } else {
+                            pcm_buffer src_buffer(src_format, *dst_buffer,
+                                                  channel_map_t(channel_map, channel_map + src_ch_count));
+
+                            src_connection.render(&src_buffer, args.time);
+                        }
                     }
                 }
             }
@@ -29,6 +29,7 @@ void io::_initialize() {
         this->_io_core = io_core;
         io_core->set_render_handler(this->_render_handler);
         io_core->set_maximum_frames_per_slice(this->_maximum_frames);
+        io_core->set_memory_policy(this->_memory_policy);
     }
 }
 
@@ -105,17 +106,35 @@ void io::set_render_handler(std::optional<io_render_f> handler) {
 }
 
 void io::set_maximum_frames_per_slice(uint32_t const frames) {
+    if (this->_maximum_frames == frames) {
+        return;
+    }
+
     this->_maximum_frames = frames;
 
     if (auto const &io_core = this->_io_core) {
         io_core.value()->set_maximum_frames_per_slice(frames);
     }
+
+    this->_maximum_frames_notifier->notify(frames);
 }
 
 uint32_t io::maximum_frames_per_slice() const {
     return this->_maximum_frames;
 }
 
+void io::set_memory_policy(audio::memory_policy const policy) {
+    this->_memory_policy = policy;
+
+    if (auto const &io_core = this->_io_core) {
+        io_core.value()->set_memory_policy(policy);
+    }
+}
+
+audio::memory_policy io::memory_policy() const {
+    return this->_memory_policy;
+}
+
 void io::start() {
     if (this->_is_running) {
         return;
@@ -146,6 +165,10 @@ observing::canceller_ptr io::observe_running(std::function<void(running_method c
     return this->_running_notifier->observe(std::move(handler));
 }
 
+observing::canceller_ptr io::observe_maximum_frames_per_slice(std::function<void(uint32_t const &)> &&handler) {
+    return this->_maximum_frames_notifier->observe(std::move(handler));
+}
+
 observing::canceller_ptr io::observe_device(observing::caller<device_observing_pair_t>::handler_f &&handler,
                                             bool const sync) {
     return this->_device_fetcher->observe(std::move(handler), sync);
@@ -35,11 +35,14 @@ struct io final {
     void set_render_handler(std::optional<io_render_f>);
     void set_maximum_frames_per_slice(uint32_t const);
     [[nodiscard]] uint32_t maximum_frames_per_slice() const;
+    void set_memory_policy(audio::memory_policy const);
+    [[nodiscard]] audio::memory_policy memory_policy() const;
 
     void start();
     void stop();
 
     observing::canceller_ptr observe_running(std::function<void(running_method const &)> &&);
+    observing::canceller_ptr observe_maximum_frames_per_slice(std::function<void(uint32_t const &)> &&);
     observing::canceller_ptr observe_device(observing::caller<device_observing_pair_t>::handler_f &&,
                                             bool const sync = true);
 
@@ -51,9 +54,11 @@ struct io final {
     bool _is_running = false;
     std::optional<io_render_f> _render_handler = std::nullopt;
     uint32_t _maximum_frames = 4096;
+    audio::memory_policy _memory_policy = audio::memory_policy::standard;
 
     observing::notifier_ptr<running_method> const _running_notifier =
         observing::notifier<running_method>::make_shared();
+    observing::notifier_ptr<uint32_t> const _maximum_frames_notifier = observing::notifier<uint32_t>::make_shared();
     observing::fetcher_ptr<device_observing_pair_t> _device_fetcher;
     std::optional<observing::canceller_ptr> _device_updated_canceller = std::nullopt;
     std::optional<observing::canceller_ptr> _interruption_canceller = std::nullopt;
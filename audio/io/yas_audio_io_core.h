@@ -13,6 +13,7 @@ struct io_core {
 
     virtual void set_render_handler(std::optional<io_render_f>) = 0;
     virtual void set_maximum_frames_per_slice(uint32_t const) = 0;
+    virtual void set_memory_policy(audio::memory_policy const) = 0;
 
     virtual bool start() = 0;
     virtual void stop() = 0;
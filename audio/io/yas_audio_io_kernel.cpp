@@ -8,10 +8,16 @@ using namespace yas;
 using namespace yas::audio;
 
 io_kernel::io_kernel(io_render_f const &render_handler, std::optional<format> const &input_format,
-                     std::optional<format> const &output_format, uint32_t const frame_capacity)
+                     std::optional<format> const &output_format, uint32_t const frame_capacity,
+                     audio::memory_policy const memory_policy)
     : render_handler(render_handler),
-      input_buffer(input_format ? std::make_shared<pcm_buffer>(*input_format, frame_capacity) : nullptr),
-      output_buffer(output_format ? std::make_shared<pcm_buffer>(*output_format, frame_capacity) : nullptr) {
+      input_buffer(input_format ? std::make_shared<pcm_buffer>(*input_format, frame_capacity,
+                                                               pcm_buffer::default_alignment, memory_policy) :
+                                  nullptr),
+      output_buffer(output_format ? std::make_shared<pcm_buffer>(*output_format, frame_capacity,
+                                                                 pcm_buffer::default_alignment, memory_policy) :
+                                    nullptr),
+      _memory_policy(memory_policy) {
 }
 
 void io_kernel::reset_buffers() {
@@ -24,7 +30,31 @@ void io_kernel::reset_buffers() {
     }
 }
 
+bool io_kernel::reconfigure(io_render_f const &render_handler, std::optional<format> const &input_format,
+                            std::optional<format> const &output_format, uint32_t const frame_capacity,
+                            audio::memory_policy const memory_policy) {
+    if (memory_policy != this->_memory_policy || input_format.has_value() != (this->input_buffer != nullptr) ||
+        output_format.has_value() != (this->output_buffer != nullptr)) {
+        return false;
+    }
+
+    this->render_handler = render_handler;
+    this->input_time = std::nullopt;
+
+    if (auto const &buffer = this->input_buffer) {
+        buffer->reconfigure(*input_format, frame_capacity);
+    }
+
+    if (auto const &buffer = this->output_buffer) {
+        buffer->reconfigure(*output_format, frame_capacity);
+    }
+
+    return true;
+}
+
 io_kernel_ptr io_kernel::make_shared(io_render_f const &render_handler, std::optional<format> const &input_format,
-                                     std::optional<format> const &output_format, uint32_t const frame_capacity) {
-    return std::shared_ptr<io_kernel>(new io_kernel{render_handler, input_format, output_format, frame_capacity});
+                                     std::optional<format> const &output_format, uint32_t const frame_capacity,
+                                     audio::memory_policy const memory_policy) {
+    return std::shared_ptr<io_kernel>(
+        new io_kernel{render_handler, input_format, output_format, frame_capacity, memory_policy});
 }
@@ -20,21 +20,29 @@ struct io_render_args {
 using io_render_f = std::function<void(io_render_args)>;
 
 struct io_kernel final {
-    io_render_f const render_handler;
+    io_render_f render_handler;
     pcm_buffer_ptr const input_buffer;
     pcm_buffer_ptr const output_buffer;
     std::optional<time> input_time = std::nullopt;
 
     void reset_buffers();
 
+    [[nodiscard]] bool reconfigure(io_render_f const &, std::optional<audio::format> const &input_format,
+                                   std::optional<audio::format> const &output_format, uint32_t const frame_capacity,
+                                   audio::memory_policy const = audio::memory_policy::standard);
+
     [[nodiscard]] static io_kernel_ptr make_shared(io_render_f const &,
                                                    std::optional<audio::format> const &input_format,
                                                    std::optional<audio::format> const &output_format,
-                                                   uint32_t const frame_capacity);
+                                                   uint32_t const frame_capacity,
+                                                   audio::memory_policy const = audio::memory_policy::standard);
 
    private:
+    audio::memory_policy const _memory_policy;
+
     io_kernel(io_render_f const &, std::optional<audio::format> const &input_format,
-              std::optional<audio::format> const &output_format, uint32_t const frame_capacity);
+              std::optional<audio::format> const &output_format, uint32_t const frame_capacity,
+              audio::memory_policy const);
 
     io_kernel(io_kernel const &) = delete;
     io_kernel(io_kernel &&) = delete;
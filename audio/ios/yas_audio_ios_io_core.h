@@ -19,6 +19,7 @@ struct ios_io_core final : io_core {
 
     void set_render_handler(std::optional<io_render_f>) override;
     void set_maximum_frames_per_slice(uint32_t const) override;
+    void set_memory_policy(audio::memory_policy const) override;
 
     bool start() override;
     void stop() override;
@@ -34,12 +35,14 @@ struct ios_io_core final : io_core {
 
     std::optional<io_render_f> _render_handler = std::nullopt;
     uint32_t _maximum_frames = 4096;
+    audio::memory_policy _memory_policy = audio::memory_policy::standard;
+    io_kernel_ptr _kernel = nullptr;
 
     bool _is_started = false;
 
     ios_io_core(ios_device_ptr const &);
 
-    [[nodiscard]] io_kernel_ptr _make_kernel() const;
+    [[nodiscard]] io_kernel_ptr _make_kernel();
     void _create_engine();
     void _dispose_engine();
     [[nodiscard]] bool _start_engine();
@@ -55,6 +55,13 @@ void ios_io_core::set_maximum_frames_per_slice(uint32_t const frames) {
     }
 }
 
+void ios_io_core::set_memory_policy(audio::memory_policy const policy) {
+    if (this->_memory_policy != policy) {
+        this->_memory_policy = policy;
+        this->_reload_if_needed();
+    }
+}
+
 bool ios_io_core::start() {
     if (this->_is_started) {
         return true;
@@ -72,7 +79,7 @@ void ios_io_core::stop() {
     this->_is_started = false;
 }
 
-io_kernel_ptr ios_io_core::_make_kernel() const {
+io_kernel_ptr ios_io_core::_make_kernel() {
     auto const &output_format = this->_device->output_format();
     auto const &input_format = this->_device->input_format();
 
@@ -88,8 +95,16 @@ io_kernel_ptr ios_io_core::_make_kernel() const {
         return nullptr;
     }
 
-    return io_kernel::make_shared(this->_render_handler.value(), input_format.has_value() ? input_format : std::nullopt,
-                                  output_format.has_value() ? output_format : std::nullopt, this->_maximum_frames);
+    if (this->_kernel && this->_kernel->reconfigure(this->_render_handler.value(), input_format, output_format,
+                                                    this->_maximum_frames, this->_memory_policy)) {
+        return this->_kernel;
+    }
+
+    this->_kernel = io_kernel::make_shared(this->_render_handler.value(),
+                                           input_format.has_value() ? input_format : std::nullopt,
+                                           output_format.has_value() ? output_format : std::nullopt,
+                                           this->_maximum_frames, this->_memory_policy);
+    return this->_kernel;
 }
 
 void ios_io_core::_create_engine() {
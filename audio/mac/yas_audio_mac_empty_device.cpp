@@ -17,6 +17,9 @@ struct dummy_io_core : io_core {
     void set_maximum_frames_per_slice(uint32_t const) override {
     }
 
+    void set_memory_policy(audio::memory_policy const) override {
+    }
+
     bool start() override {
         return false;
     }
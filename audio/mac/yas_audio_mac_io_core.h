@@ -16,6 +16,7 @@ struct mac_io_core final : io_core {
 
     void set_render_handler(std::optional<io_render_f>) override;
     void set_maximum_frames_per_slice(uint32_t const) override;
+    void set_memory_policy(audio::memory_policy const) override;
 
     bool start() override;
     void stop() override;
@@ -28,12 +29,14 @@ struct mac_io_core final : io_core {
 
     std::optional<io_render_f> _render_handler = std::nullopt;
     uint32_t _maximum_frames = 4096;
+    audio::memory_policy _memory_policy = audio::memory_policy::standard;
+    io_kernel_ptr _kernel = nullptr;
 
     bool _is_started = false;
 
     mac_io_core(mac_device_ptr const &);
 
-    [[nodiscard]] io_kernel_ptr _make_kernel() const;
+    [[nodiscard]] io_kernel_ptr _make_kernel();
     void _create_io_proc();
     void _destroy_io_proc();
     void _reload_if_needed();
@@ -32,6 +32,13 @@ void mac_io_core::set_maximum_frames_per_slice(uint32_t const frames) {
     }
 }
 
+void mac_io_core::set_memory_policy(audio::memory_policy const policy) {
+    if (this->_memory_policy != policy) {
+        this->_memory_policy = policy;
+        this->_reload_if_needed();
+    }
+}
+
 bool mac_io_core::start() {
     if (this->_is_started) {
         return true;
@@ -57,7 +64,7 @@ void mac_io_core::stop() {
     this->_is_started = false;
 }
 
-io_kernel_ptr mac_io_core::_make_kernel() const {
+io_kernel_ptr mac_io_core::_make_kernel() {
     auto const &output_format = this->_device->output_format();
     auto const &input_format = this->_device->input_format();
 
@@ -73,7 +80,14 @@ io_kernel_ptr mac_io_core::_make_kernel() const {
         return nullptr;
     }
 
-    return io_kernel::make_shared(this->_render_handler.value(), input_format, output_format, this->_maximum_frames);
+    if (this->_kernel && this->_kernel->reconfigure(this->_render_handler.value(), input_format, output_format,
+                                                    this->_maximum_frames, this->_memory_policy)) {
+        return this->_kernel;
+    }
+
+    this->_kernel = io_kernel::make_shared(this->_render_handler.value(), input_format, output_format,
+                                           this->_maximum_frames, this->_memory_policy);
+    return this->_kernel;
 }
 
 void mac_io_core::_create_io_proc() {
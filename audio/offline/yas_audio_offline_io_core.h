@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <audio/yas_audio_timeline_clock.h>
+
 #include "yas_audio_io_core.h"
 
 namespace yas::audio {
@@ -12,10 +14,14 @@ struct offline_io_core : io_core {
 
     void set_render_handler(std::optional<io_render_f>) override;
     void set_maximum_frames_per_slice(uint32_t const) override;
+    void set_memory_policy(audio::memory_policy const) override;
 
     [[nodiscard]] bool start() override;
     void stop() override;
 
+    // the clock is reset to zero every time rendering starts
+    [[nodiscard]] timeline_clock_ptr const &clock() const;
+
     static offline_io_core_ptr make_shared(offline_device_ptr const &);
 
    private:
@@ -23,9 +29,11 @@ struct offline_io_core : io_core {
 
     offline_device_ptr const _device;
     std::shared_ptr<render_context> _render_context = nullptr;
+    timeline_clock_ptr const _clock;
 
     std::optional<io_render_f> _render_handler = std::nullopt;
     uint32_t _maximum_frames = 4096;
+    audio::memory_policy _memory_policy = audio::memory_policy::standard;
 
     offline_io_core(offline_device_ptr const &);
 
@@ -48,7 +48,8 @@ struct offline_io_core::render_context {
     std::optional<offline_completion_f> _completion;
 };
 
-offline_io_core::offline_io_core(offline_device_ptr const &device) : _device(device) {
+offline_io_core::offline_io_core(offline_device_ptr const &device)
+    : _device(device), _clock(timeline_clock::make_shared(device->output_format()->sample_rate())) {
 }
 
 offline_io_core::~offline_io_core() {
@@ -63,6 +64,10 @@ void offline_io_core::set_maximum_frames_per_slice(uint32_t const frames) {
     this->_maximum_frames = frames;
 }
 
+void offline_io_core::set_memory_policy(audio::memory_policy const policy) {
+    this->_memory_policy = policy;
+}
+
 bool offline_io_core::start() {
     if (this->_render_context) {
         return false;
@@ -75,11 +80,10 @@ bool offline_io_core::start() {
     }
 
     this->_render_context = std::make_shared<render_context>(this->_device->completion_handler());
+    this->_clock->reset();
 
-    std::thread thread{[kernel = std::move(kernel), render_context = this->_render_context,
+    std::thread thread{[kernel = std::move(kernel), render_context = this->_render_context, clock = this->_clock,
                         device_render_handler = this->_device->render_handler()]() mutable {
-        uint32_t current_sample_time = 0;
-
         while (!render_context->is_cancelled) {
             kernel->reset_buffers();
 
@@ -89,7 +93,7 @@ bool offline_io_core::start() {
                 break;
             }
 
-            time time(current_sample_time, render_buffer->format().sample_rate());
+            auto const time = clock->time();
 
             kernel->render_handler({.output_buffer = render_buffer.get(),
                                     .output_time = time,
@@ -104,7 +108,7 @@ bool offline_io_core::start() {
                 break;
             }
 
-            current_sample_time += render_buffer->frame_capacity();
+            clock->advance(render_buffer->frame_capacity());
         }
 
         render_context->promise->set_value();
@@ -123,6 +127,10 @@ void offline_io_core::stop() {
     }
 }
 
+timeline_clock_ptr const &offline_io_core::clock() const {
+    return this->_clock;
+}
+
 io_kernel_ptr offline_io_core::_make_kernel() const {
     auto const &output_format = this->_device->output_format();
 
@@ -134,7 +142,8 @@ io_kernel_ptr offline_io_core::_make_kernel() const {
         return nullptr;
     }
 
-    return io_kernel::make_shared(this->_render_handler.value(), std::nullopt, output_format, this->_maximum_frames);
+    return io_kernel::make_shared(this->_render_handler.value(), std::nullopt, output_format, this->_maximum_frames,
+                                  this->_memory_policy);
 }
 
 offline_io_core_ptr offline_io_core::make_shared(offline_device_ptr const &device) {
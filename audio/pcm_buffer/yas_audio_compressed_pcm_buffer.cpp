@@ -0,0 +1,645 @@
+//
+//  yas_audio_compressed_pcm_buffer.cpp
+//
+
+#include "yas_audio_compressed_pcm_buffer.h"
+
+#include <audio/yas_audio_conversion.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+using namespace yas;
+using namespace yas::audio;
+
+namespace yas::audio::compressed_pcm_buffer_utils {
+enum class block_kind : uint32_t {
+    constant = 0,
+    predicted = 1,
+    verbatim = 2,
+};
+
+static uint32_t constexpr kind_bits = 2;
+static uint32_t constexpr shift_bits = 6;
+static uint32_t constexpr order_bits = 3;
+static uint32_t constexpr rice_param_bits = 6;
+static uint32_t constexpr value_bits = 64;
+static uint32_t constexpr max_order = 4;
+static uint32_t constexpr max_rice_param = 62;
+static uint32_t constexpr partition_length = 256;
+static uint32_t constexpr escape_quotient = 32;
+static uint32_t constexpr no_shift = 63;
+static int64_t constexpr max_predictable_value = int64_t(1) << 40;
+
+struct bit_writer {
+    explicit bit_writer(std::vector<uint8_t> &data) : _data(data) {
+    }
+
+    void write(uint64_t const value, uint32_t const bits) {
+        if (bits > 32) {
+            this->_write_bits(value >> 32, bits - 32);
+            this->_write_bits(value, 32);
+        } else {
+            this->_write_bits(value, bits);
+        }
+    }
+
+    void write_unary(uint32_t quotient) {
+        while (quotient >= 32) {
+            this->_write_bits(0, 32);
+            quotient -= 32;
+        }
+        this->_write_bits(1, quotient + 1);
+    }
+
+    void flush() {
+        if (this->_count > 0) {
+            this->_data.push_back(static_cast<uint8_t>(this->_acc << (8 - this->_count)));
+            this->_acc = 0;
+            this->_count = 0;
+        }
+    }
+
+   private:
+    std::vector<uint8_t> &_data;
+    uint64_t _acc = 0;
+    uint32_t _count = 0;
+
+    void _write_bits(uint64_t const value, uint32_t const bits) {
+        if (bits == 0) {
+            return;
+        }
+
+        this->_acc = (this->_acc << bits) | (value & ((uint64_t(1) << bits) - 1));
+        this->_count += bits;
+
+        while (this->_count >= 8) {
+            this->_count -= 8;
+            this->_data.push_back(static_cast<uint8_t>(this->_acc >> this->_count));
+        }
+    }
+};
+
+struct bit_reader {
+    bit_reader(uint8_t const *const begin, uint8_t const *const end) : _ptr(begin), _end(end) {
+    }
+
+    uint64_t read(uint32_t const bits) {
+        if (bits > 32) {
+            uint64_t const high = this->_read_bits(bits - 32);
+            return (high << 32) | this->_read_bits(32);
+        } else {
+            return this->_read_bits(bits);
+        }
+    }
+
+    uint32_t read_unary() {
+        uint32_t quotient = 0;
+
+        while (true) {
+            this->_refill();
+
+            if (this->_acc != 0) {
+                uint32_t const zeros = static_cast<uint32_t>(__builtin_clzll(this->_acc));
+                this->_acc <<= zeros + 1;
+                this->_count -= zeros + 1;
+                return quotient + zeros;
+            }
+
+            if (this->_count == 0) {
+                throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " : unexpected end of data.");
+            }
+
+            quotient += this->_count;
+            this->_count = 0;
+        }
+    }
+
+   private:
+    uint8_t const *_ptr;
+    uint8_t const *const _end;
+    uint64_t _acc = 0;
+    uint32_t _count = 0;
+
+    void _refill() {
+        while (this->_count <= 56 && this->_ptr < this->_end) {
+            this->_acc |= static_cast<uint64_t>(*this->_ptr++) << (56 - this->_count);
+            this->_count += 8;
+        }
+    }
+
+    uint64_t _read_bits(uint32_t const bits) {
+        if (bits == 0) {
+            return 0;
+        }
+
+        this->_refill();
+
+        uint64_t const value = this->_acc >> (64 - bits);
+        this->_acc <<= bits;
+        this->_count -= bits;
+        return value;
+    }
+};
+
+static uint64_t to_zigzag(int64_t const value) {
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+static int64_t from_zigzag(uint64_t const value) {
+    return static_cast<int64_t>((value >> 1) ^ (~(value & 1) + 1));
+}
+
+static int64_t sign_extend(uint64_t const value, uint32_t const bits) {
+    return static_cast<int64_t>(value << (64 - bits)) >> (64 - bits);
+}
+
+static int64_t predict(uint32_t const order, int64_t const *const end) {
+    switch (order) {
+        case 1:
+            return end[-1];
+        case 2:
+            return 2 * end[-1] - end[-2];
+        case 3:
+            return 3 * end[-1] - 3 * end[-2] + end[-3];
+        case 4:
+            return 4 * end[-1] - 6 * end[-2] + 4 * end[-3] - end[-4];
+        default:
+            return 0;
+    }
+}
+
+static uint64_t rice_cost(uint64_t const *const residuals, uint32_t const length, uint32_t const param) {
+    uint64_t cost = 0;
+    for (uint32_t idx = 0; idx < length; ++idx) {
+        uint64_t const quotient = residuals[idx] >> param;
+        cost += quotient < escape_quotient ? quotient + 1 + param : escape_quotient + 1 + value_bits;
+    }
+    return cost;
+}
+
+static uint32_t rice_param(uint64_t const *const residuals, uint32_t const length, uint64_t &cost) {
+    double sum = 0.0;
+    for (uint32_t idx = 0; idx < length; ++idx) {
+        sum += static_cast<double>(residuals[idx]);
+    }
+
+    double const mean = sum / length;
+    uint32_t const estimated =
+        mean >= 1.0 ? std::min(static_cast<uint32_t>(std::log2(mean)), max_rice_param) : uint32_t(0);
+
+    uint32_t best_param = estimated;
+    cost = rice_cost(residuals, length, estimated);
+
+    for (uint32_t const param : {estimated - 1, estimated + 1}) {
+        if (param > max_rice_param) {
+            continue;
+        }
+
+        uint64_t const param_cost = rice_cost(residuals, length, param);
+        if (param_cost < cost) {
+            cost = param_cost;
+            best_param = param;
+        }
+    }
+
+    return best_param;
+}
+
+template <typename T>
+static int64_t to_raw_value(T const sample) {
+    if constexpr (std::is_same_v<T, int24_t>) {
+        return to_int32(sample);
+    } else if constexpr (std::is_same_v<T, float16_t>) {
+        return static_cast<int16_t>(sample.bits);
+    } else if constexpr (std::is_same_v<T, float>) {
+        int32_t bits;
+        std::memcpy(&bits, &sample, sizeof(int32_t));
+        return bits;
+    } else if constexpr (std::is_same_v<T, double>) {
+        int64_t bits;
+        std::memcpy(&bits, &sample, sizeof(int64_t));
+        return bits;
+    } else {
+        return sample;
+    }
+}
+
+template <typename T>
+static T to_sample(int64_t const value, bool const is_scaled, double const scale) {
+    if constexpr (std::is_same_v<T, int24_t>) {
+        return to_int24(static_cast<int32_t>(value));
+    } else if constexpr (std::is_same_v<T, float16_t>) {
+        return float16_t{.bits = static_cast<uint16_t>(value)};
+    } else if constexpr (std::is_floating_point_v<T>) {
+        if (is_scaled) {
+            return static_cast<T>(value) * static_cast<T>(scale);
+        }
+        using bits_t = std::conditional_t<std::is_same_v<T, float>, int32_t, int64_t>;
+        bits_t const bits = static_cast<bits_t>(value);
+        T sample;
+        std::memcpy(&sample, &bits, sizeof(T));
+        return sample;
+    } else {
+        return static_cast<T>(value);
+    }
+}
+
+template <typename T>
+static std::optional<uint32_t> find_shift(T const *const ptr, uint32_t const stride, uint32_t const length) {
+    if constexpr (std::is_floating_point_v<T>) {
+        for (uint32_t const shift : {15u, 23u, 31u}) {
+            T const scale = std::ldexp(T(1), static_cast<int>(shift));
+            T const inverse = std::ldexp(T(1), -static_cast<int>(shift));
+            bool is_exact = true;
+
+            for (uint32_t frame = 0; frame < length; ++frame) {
+                T const sample = ptr[frame * stride];
+                T const scaled = sample * scale;
+                if (!(std::abs(scaled) <= T(4294967296.0)) || scaled != std::trunc(scaled)) {
+                    is_exact = false;
+                    break;
+                }
+
+                T const restored = static_cast<T>(static_cast<int64_t>(scaled)) * inverse;
+                if (std::memcmp(&restored, &sample, sizeof(T)) != 0) {
+                    is_exact = false;
+                    break;
+                }
+            }
+
+            if (is_exact) {
+                return shift;
+            }
+        }
+    }
+
+    return std::nullopt;
+}
+
+struct encoder {
+    explicit encoder(uint32_t const block_length) {
+        this->_raw_values.resize(block_length);
+        this->_scaled_values.resize(block_length);
+        this->_residuals.resize(block_length);
+    }
+
+    template <typename T>
+    void encode(bit_writer &writer, T const *const ptr, uint32_t const stride, uint32_t const length) {
+        uint32_t const bits = sizeof(T) * 8;
+
+        for (uint32_t frame = 0; frame < length; ++frame) {
+            this->_raw_values[frame] = to_raw_value(ptr[frame * stride]);
+        }
+
+        std::optional<uint32_t> const shift = find_shift(ptr, stride, length);
+        int64_t const *values = this->_raw_values.data();
+
+        if constexpr (std::is_floating_point_v<T>) {
+            if (shift) {
+                double const scale = std::ldexp(1.0, static_cast<int>(*shift));
+                for (uint32_t frame = 0; frame < length; ++frame) {
+                    this->_scaled_values[frame] = static_cast<int64_t>(ptr[frame * stride] * scale);
+                }
+                values = this->_scaled_values.data();
+            }
+        }
+
+        uint32_t const shift_value = shift ? *shift : no_shift;
+
+        if (std::all_of(values, values + length, [first = values[0]](int64_t const value) { return value == first; })) {
+            writer.write(static_cast<uint32_t>(block_kind::constant), kind_bits);
+            writer.write(shift_value, shift_bits);
+            writer.write(static_cast<uint64_t>(values[0]), value_bits);
+            return;
+        }
+
+        uint64_t const verbatim_cost = static_cast<uint64_t>(bits) * length;
+
+        if (std::all_of(values, values + length, [](int64_t const value) {
+                return -max_predictable_value < value && value < max_predictable_value;
+            })) {
+            uint32_t const order = this->_select_order(values, length);
+            uint64_t cost = kind_bits + shift_bits + order_bits + order * value_bits;
+            for (uint32_t frame = order; frame < length; ++frame) {
+                this->_residuals[frame] = to_zigzag(values[frame] - predict(order, &values[frame]));
+            }
+
+            std::vector<std::pair<uint32_t, uint32_t>> params;
+            for (uint32_t begin = 0; begin < length; begin += partition_length) {
+                uint32_t const from = std::max(begin, order);
+                uint32_t const to = std::min(begin + partition_length, length);
+                if (from < to) {
+                    uint64_t partition_cost = 0;
+                    params.emplace_back(from, rice_param(&this->_residuals[from], to - from, partition_cost));
+                    cost += rice_param_bits + partition_cost;
+                }
+            }
+
+            if (cost < verbatim_cost) {
+                writer.write(static_cast<uint32_t>(block_kind::predicted), kind_bits);
+                writer.write(shift_value, shift_bits);
+                writer.write(order, order_bits);
+                for (uint32_t frame = 0; frame < order; ++frame) {
+                    writer.write(static_cast<uint64_t>(values[frame]), value_bits);
+                }
+                for (auto const &[from, param] : params) {
+                    uint32_t const to = std::min((from / partition_length + 1) * partition_length, length);
+                    writer.write(param, rice_param_bits);
+                    for (uint32_t frame = from; frame < to; ++frame) {
+                        uint64_t const residual = this->_residuals[frame];
+                        uint64_t const quotient = residual >> param;
+                        if (quotient < escape_quotient) {
+                            writer.write_unary(static_cast<uint32_t>(quotient));
+                            writer.write(residual, param);
+                        } else {
+                            writer.write_unary(escape_quotient);
+                            writer.write(residual, value_bits);
+                        }
+                    }
+                }
+                return;
+            }
+        }
+
+        writer.write(static_cast<uint32_t>(block_kind::verbatim), kind_bits);
+        writer.write(no_shift, shift_bits);
+        for (uint32_t frame = 0; frame < length; ++frame) {
+            writer.write(static_cast<uint64_t>(this->_raw_values[frame]), bits);
+        }
+    }
+
+   private:
+    std::vector<int64_t> _raw_values;
+    std::vector<int64_t> _scaled_values;
+    std::vector<uint64_t> _residuals;
+
+    uint32_t _select_order(int64_t const *const values, uint32_t const length) {
+        uint32_t const order_limit = std::min(max_order, length - 1);
+        double errors[max_order + 1] = {0.0};
+
+        for (uint32_t frame = order_limit; frame < length; ++frame) {
+            for (uint32_t order = 0; order <= order_limit; ++order) {
+                int64_t const residual = values[frame] - predict(order, &values[frame]);
+                errors[order] += std::abs(static_cast<double>(residual));
+            }
+        }
+
+        return static_cast<uint32_t>(std::min_element(errors, errors + order_limit + 1) - errors);
+    }
+};
+
+template <typename T>
+static void decode(bit_reader &reader, uint32_t const skip, uint32_t const end, T *const to, uint32_t const stride) {
+    auto const kind = static_cast<block_kind>(reader.read(kind_bits));
+    uint32_t const shift = static_cast<uint32_t>(reader.read(shift_bits));
+    bool const is_scaled = shift != no_shift;
+    double const scale = is_scaled ? std::ldexp(1.0, -static_cast<int>(shift)) : 0.0;
+
+    switch (kind) {
+        case block_kind::constant: {
+            T const sample = to_sample<T>(static_cast<int64_t>(reader.read(value_bits)), is_scaled, scale);
+            for (uint32_t frame = skip; frame < end; ++frame) {
+                to[(frame - skip) * stride] = sample;
+            }
+        } break;
+
+        case block_kind::predicted: {
+            uint32_t const order = static_cast<uint32_t>(reader.read(order_bits));
+            int64_t history[max_order] = {0};
+            int64_t *const history_end = history + max_order;
+
+            for (uint32_t frame = 0; frame < order; ++frame) {
+                int64_t const value = static_cast<int64_t>(reader.read(value_bits));
+                if (skip <= frame && frame < end) {
+                    to[(frame - skip) * stride] = to_sample<T>(value, is_scaled, scale);
+                }
+                std::copy(history + 1, history_end, history);
+                history_end[-1] = value;
+            }
+
+            for (uint32_t begin = 0; begin < end; begin += partition_length) {
+                uint32_t const from = std::max(begin, order);
+                uint32_t const to_frame = std::min(begin + partition_length, end);
+                uint32_t const param = static_cast<uint32_t>(reader.read(rice_param_bits));
+
+                for (uint32_t frame = from; frame < to_frame; ++frame) {
+                    uint32_t const quotient = reader.read_unary();
+                    uint64_t const residual = quotient < escape_quotient
+                                                  ? (static_cast<uint64_t>(quotient) << param) | reader.read(param)
+                                                  : reader.read(value_bits);
+                    int64_t const value = predict(order, history_end) + from_zigzag(residual);
+                    if (skip <= frame) {
+                        to[(frame - skip) * stride] = to_sample<T>(value, is_scaled, scale);
+                    }
+                    history[0] = history[1];
+                    history[1] = history[2];
+                    history[2] = history[3];
+                    history[3] = value;
+                }
+            }
+        } break;
+
+        case block_kind::verbatim: {
+            uint32_t const bits = sizeof(T) * 8;
+            for (uint32_t frame = 0; frame < end; ++frame) {
+                int64_t const value = sign_extend(reader.read(bits), bits);
+                if (skip <= frame) {
+                    to[(frame - skip) * stride] = to_sample<T>(value, false, 0.0);
+                }
+            }
+        } break;
+    }
+}
+}  // namespace yas::audio::compressed_pcm_buffer_utils
+
+compressed_pcm_buffer::compressed_pcm_buffer(pcm_buffer const &buffer, uint32_t const block_length)
+    : _format(buffer.format()), _frame_length(buffer.frame_length()), _block_length(block_length) {
+    uint32_t const channel_count = this->_format.channel_count();
+    std::size_t const block_count = this->block_count();
+
+    this->_block_offsets.reserve(block_count * channel_count + 1);
+
+    auto encode = [this, &buffer, channel_count](auto const *const tag) {
+        using T = std::remove_const_t<std::remove_pointer_t<decltype(tag)>>;
+
+        compressed_pcm_buffer_utils::encoder encoder{this->_block_length};
+        uint32_t const stride = this->_format.stride();
+
+        for (uint32_t begin_frame = 0; begin_frame < this->_frame_length; begin_frame += this->_block_length) {
+            uint32_t const length = std::min(this->_block_length, this->_frame_length - begin_frame);
+
+            for (uint32_t ch_idx = 0; ch_idx < channel_count; ++ch_idx) {
+                T const *const ptr = &buffer.data_ptr_at_channel<T>(ch_idx)[begin_frame * stride];
+                compressed_pcm_buffer_utils::bit_writer writer{this->_data};
+                this->_block_offsets.push_back(this->_data.size());
+                encoder.encode(writer, ptr, stride, length);
+                writer.flush();
+            }
+        }
+    };
+
+    switch (this->_format.pcm_format()) {
+        case pcm_format::float32:
+            encode(static_cast<float const *>(nullptr));
+            break;
+        case pcm_format::float64:
+            encode(static_cast<double const *>(nullptr));
+            break;
+        case pcm_format::int16:
+            encode(static_cast<int16_t const *>(nullptr));
+            break;
+        case pcm_format::fixed824:
+            encode(static_cast<int32_t const *>(nullptr));
+            break;
+        case pcm_format::int24:
+            encode(static_cast<int24_t const *>(nullptr));
+            break;
+        case pcm_format::float16:
+            encode(static_cast<float16_t const *>(nullptr));
+            break;
+        case pcm_format::other:
+            throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : invalid pcm_format.");
+    }
+
+    this->_block_offsets.push_back(this->_data.size());
+    this->_data.shrink_to_fit();
+}
+
+audio::format const &compressed_pcm_buffer::format() const {
+    return this->_format;
+}
+
+uint32_t compressed_pcm_buffer::frame_length() const {
+    return this->_frame_length;
+}
+
+uint32_t compressed_pcm_buffer::block_length() const {
+    return this->_block_length;
+}
+
+std::size_t compressed_pcm_buffer::block_count() const {
+    return (static_cast<std::size_t>(this->_frame_length) + this->_block_length - 1) / this->_block_length;
+}
+
+std::size_t compressed_pcm_buffer::compressed_byte_count() const {
+    return this->_data.size() + this->_block_offsets.size() * sizeof(std::size_t);
+}
+
+std::size_t compressed_pcm_buffer::uncompressed_byte_count() const {
+    return static_cast<std::size_t>(this->_frame_length) * this->_format.channel_count() *
+           this->_format.sample_byte_count();
+}
+
+pcm_buffer::copy_result compressed_pcm_buffer::decode(pcm_buffer &to_buffer) const {
+    return this->decode(to_buffer, {});
+}
+
+pcm_buffer::copy_result compressed_pcm_buffer::decode(pcm_buffer &to_buffer, pcm_buffer::copy_options args) const {
+    audio::format const &to_format = to_buffer.format();
+
+    if (to_format.pcm_format() != this->_format.pcm_format() ||
+        to_format.channel_count() != this->_format.channel_count()) {
+        return pcm_buffer::copy_result(pcm_buffer::copy_error_t::invalid_format);
+    }
+
+    if (args.from_begin_frame > this->_frame_length) {
+        return pcm_buffer::copy_result(pcm_buffer::copy_error_t::out_of_range_frame);
+    }
+
+    bool const is_whole = args.from_begin_frame == 0 && args.to_begin_frame == 0 && args.length == 0;
+    uint32_t const length = args.length ?: (this->_frame_length - args.from_begin_frame);
+    uint32_t const to_frame_length = is_whole ? to_buffer.frame_capacity() : to_buffer.frame_length();
+
+    if (length > this->_frame_length - args.from_begin_frame || args.to_begin_frame > to_frame_length ||
+        length > to_frame_length - args.to_begin_frame) {
+        return pcm_buffer::copy_result(pcm_buffer::copy_error_t::out_of_range_frame);
+    }
+
+    uint32_t const channel_count = this->_format.channel_count();
+    uint32_t const to_stride = to_format.stride();
+    uint32_t const from_end_frame = args.from_begin_frame + length;
+
+    auto decode = [this, &args, &to_buffer, channel_count, to_stride, from_end_frame](auto *const tag) {
+        using T = std::remove_pointer_t<decltype(tag)>;
+
+        std::size_t const first_block = args.from_begin_frame / this->_block_length;
+
+        for (std::size_t block_idx = first_block; block_idx * this->_block_length < from_end_frame; ++block_idx) {
+            uint32_t const block_begin = static_cast<uint32_t>(block_idx * this->_block_length);
+            uint32_t const skip = std::max(args.from_begin_frame, block_begin) - block_begin;
+            uint32_t const end = std::min(from_end_frame - block_begin, this->_block_length);
+            uint32_t const to_frame = args.to_begin_frame + block_begin + skip - args.from_begin_frame;
+
+            for (uint32_t ch_idx = 0; ch_idx < channel_count; ++ch_idx) {
+                std::size_t const offset_idx = block_idx * channel_count + ch_idx;
+                uint8_t const *const data = this->_data.data();
+                compressed_pcm_buffer_utils::bit_reader reader{data + this->_block_offsets[offset_idx],
+                                                               data + this->_block_offsets[offset_idx + 1]};
+                T *const to_ptr = &to_buffer.data_ptr_at_channel<T>(ch_idx)[to_frame * to_stride];
+                compressed_pcm_buffer_utils::decode(reader, skip, end, to_ptr, to_stride);
+            }
+        }
+    };
+
+    if (length > 0) {
+        switch (this->_format.pcm_format()) {
+            case pcm_format::float32:
+                decode(static_cast<float *>(nullptr));
+                break;
+            case pcm_format::float64:
+                decode(static_cast<double *>(nullptr));
+                break;
+            case pcm_format::int16:
+                decode(static_cast<int16_t *>(nullptr));
+                break;
+            case pcm_format::fixed824:
+                decode(static_cast<int32_t *>(nullptr));
+                break;
+            case pcm_format::int24:
+                decode(static_cast<int24_t *>(nullptr));
+                break;
+            case pcm_format::float16:
+                decode(static_cast<float16_t *>(nullptr));
+                break;
+            case pcm_format::other:
+                return pcm_buffer::copy_result(pcm_buffer::copy_error_t::invalid_format);
+        }
+    }
+
+    if (is_whole) {
+        to_buffer.set_frame_length(length);
+    }
+
+    return pcm_buffer::copy_result(length);
+}
+
+pcm_buffer::copy_result compressed_pcm_buffer::decode_block(std::size_t const block_idx, pcm_buffer &to_buffer,
+                                                            uint32_t const to_begin_frame) const {
+    if (block_idx >= this->block_count()) {
+        return pcm_buffer::copy_result(pcm_buffer::copy_error_t::out_of_range_frame);
+    }
+
+    uint32_t const begin_frame = static_cast<uint32_t>(block_idx * this->_block_length);
+
+    return this->decode(to_buffer, {.from_begin_frame = begin_frame,
+                                    .to_begin_frame = to_begin_frame,
+                                    .length = std::min(this->_block_length, this->_frame_length - begin_frame)});
+}
+
+compressed_pcm_buffer_ptr compressed_pcm_buffer::make_shared(pcm_buffer const &buffer, uint32_t const block_length) {
+    if (block_length == 0) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : block_length is zero.");
+    }
+
+    if (buffer.format().pcm_format() == pcm_format::other) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : invalid pcm_format.");
+    }
+
+    return compressed_pcm_buffer_ptr(new compressed_pcm_buffer{buffer, block_length});
+}
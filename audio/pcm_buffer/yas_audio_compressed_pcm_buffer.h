@@ -0,0 +1,46 @@
+//
+//  yas_audio_compressed_pcm_buffer.h
+//
+
+#pragma once
+
+#include <audio/yas_audio_format.h>
+#include <audio/yas_audio_pcm_buffer.h>
+#include <audio/yas_audio_ptr.h>
+
+#include <vector>
+
+namespace yas::audio {
+struct compressed_pcm_buffer final {
+    static uint32_t constexpr default_block_length = 4096;
+
+    [[nodiscard]] audio::format const &format() const;
+    [[nodiscard]] uint32_t frame_length() const;
+    [[nodiscard]] uint32_t block_length() const;
+    [[nodiscard]] std::size_t block_count() const;
+    [[nodiscard]] std::size_t compressed_byte_count() const;
+    [[nodiscard]] std::size_t uncompressed_byte_count() const;
+
+    pcm_buffer::copy_result decode(pcm_buffer &) const;
+    pcm_buffer::copy_result decode(pcm_buffer &, pcm_buffer::copy_options) const;
+    pcm_buffer::copy_result decode_block(std::size_t const block_idx, pcm_buffer &,
+                                         uint32_t const to_begin_frame = 0) const;
+
+    [[nodiscard]] static compressed_pcm_buffer_ptr make_shared(pcm_buffer const &,
+                                                               uint32_t const block_length = default_block_length);
+
+   private:
+    audio::format const _format;
+    uint32_t const _frame_length;
+    uint32_t const _block_length;
+    std::vector<uint8_t> _data;
+    std::vector<std::size_t> _block_offsets;
+
+    compressed_pcm_buffer(pcm_buffer const &, uint32_t const block_length);
+
+    compressed_pcm_buffer(compressed_pcm_buffer const &) = delete;
+    compressed_pcm_buffer(compressed_pcm_buffer &&) = delete;
+    compressed_pcm_buffer &operator=(compressed_pcm_buffer const &) = delete;
+    compressed_pcm_buffer &operator=(compressed_pcm_buffer &&) = delete;
+};
+}  // namespace yas::audio
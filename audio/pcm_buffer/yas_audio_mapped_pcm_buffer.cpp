@@ -0,0 +1,164 @@
+//
+//  yas_audio_mapped_pcm_buffer.cpp
+//
+
+#include "yas_audio_mapped_pcm_buffer.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <string>
+
+using namespace yas;
+using namespace yas::audio;
+
+namespace yas::audio::mapped_pcm_buffer_utils {
+static int to_madvise_flag(mapped_pcm_buffer::advice const advice) {
+    switch (advice) {
+        case mapped_pcm_buffer::advice::normal:
+            return MADV_NORMAL;
+        case mapped_pcm_buffer::advice::sequential:
+            return MADV_SEQUENTIAL;
+        case mapped_pcm_buffer::advice::random:
+            return MADV_RANDOM;
+        case mapped_pcm_buffer::advice::will_need:
+            return MADV_WILLNEED;
+        case mapped_pcm_buffer::advice::dont_need:
+            return MADV_DONTNEED;
+    }
+}
+
+static uintptr_t page_mask() {
+    static uintptr_t const mask = ~(static_cast<uintptr_t>(sysconf(_SC_PAGESIZE)) - 1);
+    return mask;
+}
+}  // namespace yas::audio::mapped_pcm_buffer_utils
+
+mapped_pcm_buffer::mapped_pcm_buffer(audio::format const &format, void *const mapped_data,
+                                     std::size_t const mapped_byte_count, abl_uptr &&abl)
+    : _mapped_data(mapped_data),
+      _mapped_byte_count(mapped_byte_count),
+      _abl(std::move(abl)),
+      _buffer(format, this->_abl.get()) {
+}
+
+mapped_pcm_buffer::~mapped_pcm_buffer() {
+    munmap(this->_mapped_data, this->_mapped_byte_count);
+}
+
+pcm_buffer const &mapped_pcm_buffer::buffer() const {
+    return this->_buffer;
+}
+
+std::size_t mapped_pcm_buffer::mapped_byte_count() const {
+    return this->_mapped_byte_count;
+}
+
+void mapped_pcm_buffer::advise(advice const advice, uint32_t const begin_frame, uint32_t const length) const {
+    if (begin_frame + length > this->_buffer.frame_length()) {
+        throw std::out_of_range(std::string(__PRETTY_FUNCTION__) + " : out of range. begin_frame(" +
+                                std::to_string(begin_frame) + ") length(" + std::to_string(length) + ")");
+    }
+
+    if (length == 0) {
+        return;
+    }
+
+    AudioBufferList const *const abl = this->_buffer.audio_buffer_list();
+    std::size_t const bytes_per_frame = this->_buffer.format().stream_description().mBytesPerFrame;
+    int const flag = mapped_pcm_buffer_utils::to_madvise_flag(advice);
+
+    for (uint32_t buf_idx = 0; buf_idx < abl->mNumberBuffers; ++buf_idx) {
+        uintptr_t const begin =
+            reinterpret_cast<uintptr_t>(abl->mBuffers[buf_idx].mData) + begin_frame * bytes_per_frame;
+        uintptr_t const aligned_begin = begin & mapped_pcm_buffer_utils::page_mask();
+        madvise(reinterpret_cast<void *>(aligned_begin), begin - aligned_begin + length * bytes_per_frame, flag);
+    }
+}
+
+mapped_pcm_buffer::make_result_t mapped_pcm_buffer::make_shared(open_args args) {
+    audio::format const &format = args.format;
+
+    if (args.file_url.path().empty()) {
+        return make_result_t{open_error_t::invalid_argument};
+    }
+
+    if (format.pcm_format() == pcm_format::other || format.channel_count() == 0) {
+        return make_result_t{open_error_t::invalid_format};
+    }
+
+    int const fd = open(args.file_url.path().c_str(), O_RDONLY);
+    if (fd < 0) {
+        return make_result_t{open_error_t::open_failed};
+    }
+
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0) {
+        close(fd);
+        return make_result_t{open_error_t::open_failed};
+    }
+
+    uint64_t const file_size = static_cast<uint64_t>(file_stat.st_size);
+    uint64_t const bytes_per_frame = static_cast<uint64_t>(format.sample_byte_count()) * format.channel_count();
+    uint64_t const buffer_bytes_per_frame = format.stream_description().mBytesPerFrame;
+
+    if (args.byte_offset > file_size) {
+        close(fd);
+        return make_result_t{open_error_t::out_of_range};
+    }
+
+    uint64_t const available_byte_count = file_size - args.byte_offset;
+    uint64_t const frame_length = args.frame_length > 0 ? args.frame_length : available_byte_count / bytes_per_frame;
+
+    if (frame_length == 0 || frame_length * bytes_per_frame > available_byte_count ||
+        frame_length * buffer_bytes_per_frame > UINT32_MAX) {
+        close(fd);
+        return make_result_t{open_error_t::out_of_range};
+    }
+
+    uint64_t const map_offset = args.byte_offset & mapped_pcm_buffer_utils::page_mask();
+    std::size_t const map_byte_count = args.byte_offset - map_offset + frame_length * bytes_per_frame;
+
+    void *const mapped_data = mmap(nullptr, map_byte_count, PROT_READ, MAP_SHARED, fd, map_offset);
+    close(fd);
+
+    if (mapped_data == MAP_FAILED) {
+        return make_result_t{open_error_t::map_failed};
+    }
+
+    uint8_t *const data = static_cast<uint8_t *>(mapped_data) + (args.byte_offset - map_offset);
+    uint32_t const buffer_byte_count = static_cast<uint32_t>(frame_length * buffer_bytes_per_frame);
+
+    auto abl = allocate_audio_buffer_list(format.buffer_count(), format.stride(), 0).first;
+    for (uint32_t buf_idx = 0; buf_idx < format.buffer_count(); ++buf_idx) {
+        abl->mBuffers[buf_idx].mData = &data[static_cast<std::size_t>(buffer_byte_count) * buf_idx];
+        abl->mBuffers[buf_idx].mDataByteSize = buffer_byte_count;
+    }
+
+    auto mapped = mapped_pcm_buffer_ptr(new mapped_pcm_buffer{format, mapped_data, map_byte_count, std::move(abl)});
+    mapped->advise(args.advice, 0, static_cast<uint32_t>(frame_length));
+
+    return make_result_t{std::move(mapped)};
+}
+
+std::string yas::to_string(mapped_pcm_buffer::open_error_t const &error) {
+    switch (error) {
+        case mapped_pcm_buffer::open_error_t::invalid_argument:
+            return "invalid_argument";
+        case mapped_pcm_buffer::open_error_t::invalid_format:
+            return "invalid_format";
+        case mapped_pcm_buffer::open_error_t::open_failed:
+            return "open_failed";
+        case mapped_pcm_buffer::open_error_t::out_of_range:
+            return "out_of_range";
+        case mapped_pcm_buffer::open_error_t::map_failed:
+            return "map_failed";
+    }
+}
+
+std::ostream &operator<<(std::ostream &os, yas::audio::mapped_pcm_buffer::open_error_t const &value) {
+    os << to_string(value);
+    return os;
+}
@@ -0,0 +1,72 @@
+//
+//  yas_audio_mapped_pcm_buffer.h
+//
+
+#pragma once
+
+#include <audio/yas_audio_format.h>
+#include <audio/yas_audio_pcm_buffer.h>
+#include <audio/yas_audio_ptr.h>
+#include <cpp_utils/yas_result.h>
+#include <cpp_utils/yas_url.h>
+
+#include <ostream>
+
+namespace yas::audio {
+struct mapped_pcm_buffer final {
+    enum class advice {
+        normal,
+        sequential,
+        random,
+        will_need,
+        dont_need,
+    };
+
+    struct open_args {
+        url file_url;
+        audio::format format;
+        uint64_t byte_offset = 0;
+        uint32_t frame_length = 0;
+        mapped_pcm_buffer::advice advice = advice::normal;
+    };
+
+    enum class open_error_t : uint32_t {
+        invalid_argument,
+        invalid_format,
+        open_failed,
+        out_of_range,
+        map_failed,
+    };
+
+    using make_result_t = result<mapped_pcm_buffer_ptr, open_error_t>;
+
+    ~mapped_pcm_buffer();
+
+    [[nodiscard]] audio::pcm_buffer const &buffer() const;
+    [[nodiscard]] std::size_t mapped_byte_count() const;
+
+    void advise(advice const, uint32_t const begin_frame, uint32_t const length) const;
+
+    [[nodiscard]] static make_result_t make_shared(open_args);
+
+   private:
+    void *_mapped_data;
+    std::size_t _mapped_byte_count;
+    abl_uptr _abl;
+    pcm_buffer _buffer;
+
+    mapped_pcm_buffer(audio::format const &, void *const mapped_data, std::size_t const mapped_byte_count,
+                      abl_uptr &&abl);
+
+    mapped_pcm_buffer(mapped_pcm_buffer const &) = delete;
+    mapped_pcm_buffer(mapped_pcm_buffer &&) = delete;
+    mapped_pcm_buffer &operator=(mapped_pcm_buffer const &) = delete;
+    mapped_pcm_buffer &operator=(mapped_pcm_buffer &&) = delete;
+};
+}  // namespace yas::audio
+
+namespace yas {
+std::string to_string(audio::mapped_pcm_buffer::open_error_t const &);
+}
+
+std::ostream &operator<<(std::ostream &, yas::audio::mapped_pcm_buffer::open_error_t const &);
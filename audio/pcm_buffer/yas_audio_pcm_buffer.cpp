@@ -4,11 +4,16 @@
 
 #include "yas_audio_pcm_buffer.h"
 
-#include <Accelerate/Accelerate.h>
+#include <audio/yas_audio_analysis.h>
+#include <audio/yas_audio_conversion.h>
+#include <audio/yas_audio_interleave.h>
+#include <audio/yas_audio_memory.h>
+#include <audio/yas_audio_mixing.h>
 #include <cpp_utils/yas_fast_each.h>
 #include <cpp_utils/yas_result.h>
 #include <cpp_utils/yas_stl_utils.h>
 
+#include <cstdlib>
 #include <exception>
 #include <functional>
 #include <string>
@@ -20,28 +25,58 @@ using namespace yas::audio;
 
 namespace yas::audio::pcm_buffer_utils {
 static std::vector<uint8_t> _dummy_data(4096 * 4);
+
+static std::size_t aligned_size(std::size_t const size, uint32_t const alignment) {
+    return (size + alignment - 1) & ~(static_cast<std::size_t>(alignment) - 1);
+}
 }
 
 std::pair<audio::abl_uptr, audio::abl_data_uptr> audio::allocate_audio_buffer_list(uint32_t const buffer_count,
                                                                                    uint32_t const channel_count,
-                                                                                   uint32_t const size) {
+                                                                                   uint32_t const size,
+                                                                                   uint32_t const alignment,
+                                                                                   memory_policy const policy) {
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : alignment is not a power of two.");
+    }
+
     abl_uptr abl_ptr((AudioBufferList *)calloc(1, sizeof(AudioBufferList) + buffer_count * sizeof(AudioBuffer)),
                      [](AudioBufferList *abl) { free(abl); });
 
     abl_ptr->mNumberBuffers = buffer_count;
-    auto data_ptr = std::make_unique<std::vector<std::vector<uint8_t>>>();
-    if (size > 0) {
-        data_ptr->reserve(buffer_count);
-    } else {
-        data_ptr = nullptr;
+
+    abl_data_uptr data_ptr = nullptr;
+    std::size_t const plane_size = pcm_buffer_utils::aligned_size(size, alignment);
+
+    if (size > 0 && buffer_count > 0) {
+        bool const is_locked = policy == memory_policy::locked;
+        // a locked slab owns its pages so that unlocking it never unlocks the pages of another slab
+        std::size_t const slab_alignment =
+            is_locked ? std::max(static_cast<std::size_t>(alignment), memory::page_size())
+                      : std::max(static_cast<std::size_t>(alignment), sizeof(void *));
+        std::size_t const slab_size =
+            is_locked ? memory::page_aligned_size(plane_size * buffer_count) : plane_size * buffer_count;
+        void *slab = nullptr;
+        if (posix_memalign(&slab, slab_alignment, slab_size) != 0) {
+            throw std::bad_alloc();
+        }
+        memset(slab, 0, slab_size);
+
+        if (is_locked && memory::lock(slab, slab_size)) {
+            data_ptr = abl_data_uptr(static_cast<uint8_t *>(slab), [slab_size](uint8_t *data) {
+                memory::unlock(data, slab_size);
+                free(data);
+            });
+        } else {
+            data_ptr = abl_data_uptr(static_cast<uint8_t *>(slab), [](uint8_t *data) { free(data); });
+        }
     }
 
     for (uint32_t i = 0; i < buffer_count; ++i) {
         abl_ptr->mBuffers[i].mNumberChannels = channel_count;
         abl_ptr->mBuffers[i].mDataByteSize = size;
-        if (size > 0) {
-            data_ptr->push_back(std::vector<uint8_t>(size));
-            abl_ptr->mBuffers[i].mData = data_ptr->at(i).data();
+        if (data_ptr) {
+            abl_ptr->mBuffers[i].mData = &data_ptr.get()[plane_size * i];
         } else {
             abl_ptr->mBuffers[i].mData = nullptr;
         }
@@ -50,6 +85,68 @@ std::pair<audio::abl_uptr, audio::abl_data_uptr> audio::allocate_audio_buffer_li
     return std::make_pair(std::move(abl_ptr), std::move(data_ptr));
 }
 
+void audio::map_audio_buffer_list(AudioBufferList const *const from_abl, AudioBufferList *const to_abl,
+                                  uint32_t const *const channel_map, uint32_t const channel_count,
+                                  uint32_t const bytes_per_frame, uint32_t const frame_length) {
+    to_abl->mNumberBuffers = channel_count;
+
+    for (uint32_t to_ch_idx = 0; to_ch_idx < channel_count; ++to_ch_idx) {
+        uint32_t const from_ch_idx = channel_map[to_ch_idx];
+        AudioBuffer &to_buffer = to_abl->mBuffers[to_ch_idx];
+        to_buffer.mNumberChannels = 1;
+
+        if (from_ch_idx != -1) {
+            if (from_ch_idx >= from_abl->mNumberBuffers) {
+                throw std::out_of_range(std::string(__PRETTY_FUNCTION__) + " : out of range. from_ch_idx(" +
+                                        std::to_string(from_ch_idx) + ") mNumberBuffers(" +
+                                        std::to_string(from_abl->mNumberBuffers) + ")");
+            }
+
+            AudioBuffer const &from_buffer = from_abl->mBuffers[from_ch_idx];
+            to_buffer.mData = from_buffer.mData;
+            to_buffer.mDataByteSize = from_buffer.mDataByteSize;
+            uint32_t actual_frame_length = from_buffer.mDataByteSize / bytes_per_frame;
+            if (frame_length != actual_frame_length) {
+                throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) +
+                                            " : invalid frame length. frame_length(" + std::to_string(frame_length) +
+                                            ") actual_frame_length(" + std::to_string(actual_frame_length) + ")");
+            }
+        } else {
+            uint32_t const size = bytes_per_frame * frame_length;
+            if (size <= pcm_buffer_utils::_dummy_data.size()) {
+                to_buffer.mData = pcm_buffer_utils::_dummy_data.data();
+                to_buffer.mDataByteSize = size;
+            } else {
+                throw std::overflow_error(std::string(__PRETTY_FUNCTION__) + " : buffer size is overflow(" +
+                                          std::to_string(size) + ")");
+            }
+        }
+    }
+}
+
+void audio::slice_audio_buffer_list(AudioBufferList const *const from_abl, AudioBufferList *const to_abl,
+                                    uint32_t const sample_byte_count, uint32_t const begin_frame,
+                                    uint32_t const length) {
+    to_abl->mNumberBuffers = from_abl->mNumberBuffers;
+
+    for (uint32_t buf_idx = 0; buf_idx < from_abl->mNumberBuffers; ++buf_idx) {
+        AudioBuffer const &from_buffer = from_abl->mBuffers[buf_idx];
+        AudioBuffer &to_buffer = to_abl->mBuffers[buf_idx];
+        uint32_t const frame_byte_count = from_buffer.mNumberChannels * sample_byte_count;
+
+        uint32_t const frame_length = frame_byte_count > 0 ? from_buffer.mDataByteSize / frame_byte_count : 0;
+
+        if (begin_frame > frame_length || length > frame_length - begin_frame) {
+            throw std::out_of_range(std::string(__PRETTY_FUNCTION__) + " : out of range. begin_frame(" +
+                                    std::to_string(begin_frame) + ") length(" + std::to_string(length) + ")");
+        }
+
+        to_buffer.mNumberChannels = from_buffer.mNumberChannels;
+        to_buffer.mData = static_cast<uint8_t *>(from_buffer.mData) + begin_frame * frame_byte_count;
+        to_buffer.mDataByteSize = length * frame_byte_count;
+    }
+}
+
 static void set_data_byte_size(audio::pcm_buffer &data, uint32_t const data_byte_size) {
     AudioBufferList *abl = data.audio_buffer_list();
     for (uint32_t i = 0; i < abl->mNumberBuffers; i++) {
@@ -65,29 +162,13 @@ static void reset_data_byte_size(audio::pcm_buffer &data) {
 
 template <typename T>
 static bool validate_pcm_format(audio::pcm_format const &pcm_format) {
-    switch (pcm_format) {
-        case audio::pcm_format::float32:
-            return typeid(T) == typeid(float);
-        case audio::pcm_format::float64:
-            return typeid(T) == typeid(double);
-        case audio::pcm_format::fixed824:
-            return typeid(T) == typeid(int32_t);
-        case audio::pcm_format::int16:
-            return typeid(T) == typeid(int16_t);
-        default:
-            return false;
-    }
+    return audio::pcm_format_of<T>() != audio::pcm_format::other && pcm_format == audio::pcm_format_of<T>();
 }
 
 namespace yas::audio {
 struct abl_info {
-    uint32_t channel_count;
-    uint32_t frame_length;
-    std::vector<uint8_t *> datas;
-    std::vector<uint32_t> strides;
-
-    abl_info() : channel_count(0), frame_length(0), datas(0), strides(0) {
-    }
+    uint32_t channel_count = 0;
+    uint32_t frame_length = 0;
 };
 
 using get_abl_info_result_t = result<abl_info, pcm_buffer::copy_error_t>;
@@ -112,18 +193,96 @@ static get_abl_info_result_t get_abl_info(AudioBufferList const *abl, uint32_t c
         data_info.channel_count += stride;
     }
 
-    if (data_info.channel_count > 0) {
-        for (uint32_t buf_idx = 0; buf_idx < buffer_count; buf_idx++) {
-            uint32_t const stride = abl->mBuffers[buf_idx].mNumberChannels;
-            uint8_t *data = static_cast<uint8_t *>(abl->mBuffers[buf_idx].mData);
-            for (uint32_t ch_idx = 0; ch_idx < stride; ++ch_idx) {
-                data_info.datas.push_back(&data[ch_idx * sample_byte_count]);
-                data_info.strides.push_back(stride);
+    return get_abl_info_result_t(std::move(data_info));
+}
+
+struct abl_channel {
+    uint8_t *data = nullptr;
+    uint32_t stride = 0;
+};
+
+static abl_channel get_abl_channel(AudioBufferList const *abl, uint32_t ch_idx, uint32_t const sample_byte_count) {
+    for (uint32_t buf_idx = 0; buf_idx < abl->mNumberBuffers; ++buf_idx) {
+        uint32_t const stride = abl->mBuffers[buf_idx].mNumberChannels;
+        if (ch_idx < stride) {
+            uint8_t *const data = static_cast<uint8_t *>(abl->mBuffers[buf_idx].mData);
+            return abl_channel{.data = &data[ch_idx * sample_byte_count], .stride = stride};
+        }
+        ch_idx -= stride;
+    }
+
+    return abl_channel{};
+}
+
+struct abl_channel_each {
+    abl_channel_each(AudioBufferList const *abl, uint32_t const sample_byte_count)
+        : _abl(abl), _sample_byte_count(sample_byte_count) {
+    }
+
+    bool next() {
+        if (this->_is_started) {
+            ++this->_ch_idx;
+        } else {
+            this->_is_started = true;
+        }
+
+        while (this->_buf_idx < this->_abl->mNumberBuffers) {
+            AudioBuffer const &buffer = this->_abl->mBuffers[this->_buf_idx];
+            if (this->_ch_idx < buffer.mNumberChannels) {
+                uint8_t *const data = static_cast<uint8_t *>(buffer.mData);
+                this->channel = abl_channel{.data = &data[this->_ch_idx * this->_sample_byte_count],
+                                            .stride = buffer.mNumberChannels};
+                return true;
             }
+            ++this->_buf_idx;
+            this->_ch_idx = 0;
+        }
+
+        return false;
+    }
+
+    abl_channel channel;
+
+   private:
+    AudioBufferList const *const _abl;
+    uint32_t const _sample_byte_count;
+    uint32_t _buf_idx = 0;
+    uint32_t _ch_idx = 0;
+    bool _is_started = false;
+};
+
+static uint32_t constexpr interleave_channel_count_max = 8;
+
+template <typename T>
+static void copy_strided(T const *const from_data, uint32_t const from_stride, T *const to_data,
+                         uint32_t const to_stride, uint32_t const length) {
+    for (uint32_t frame = 0; frame < length; ++frame) {
+        to_data[frame * to_stride] = from_data[frame * from_stride];
+    }
+}
+
+static bool is_non_interleaved(AudioBufferList const *const abl) {
+    for (uint32_t buf_idx = 0; buf_idx < abl->mNumberBuffers; ++buf_idx) {
+        if (abl->mBuffers[buf_idx].mNumberChannels != 1) {
+            return false;
         }
     }
 
-    return get_abl_info_result_t(std::move(data_info));
+    return true;
+}
+
+static bool is_equal_layout(AudioBufferList const *const abl1, AudioBufferList const *const abl2) {
+    if (abl1->mNumberBuffers != abl2->mNumberBuffers) {
+        return false;
+    }
+
+    for (uint32_t buf_idx = 0; buf_idx < abl1->mNumberBuffers; ++buf_idx) {
+        if (abl1->mBuffers[buf_idx].mNumberChannels != abl2->mBuffers[buf_idx].mNumberChannels) {
+            return false;
+        }
+    }
+
+    return true;
 }
 }  // namespace yas::audio
 
@@ -142,37 +301,9 @@ pcm_buffer::pcm_buffer(audio::format const &format, audio::abl_uptr &&abl, audio
         throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : invalid format.");
     }
 
-    abl_uptr const &to_abl = this->_abl;
-
-    AudioBufferList const *const from_abl = from_buffer.audio_buffer_list();
-    uint32_t bytesPerFrame = format.stream_description().mBytesPerFrame;
-    uint32_t const frame_length = from_buffer.frame_length();
-    uint32_t to_ch_idx = 0;
-
-    for (auto const &from_ch_idx : channel_map) {
-        if (from_ch_idx != -1) {
-            to_abl->mBuffers[to_ch_idx].mData = from_abl->mBuffers[from_ch_idx].mData;
-            to_abl->mBuffers[to_ch_idx].mDataByteSize = from_abl->mBuffers[from_ch_idx].mDataByteSize;
-            uint32_t actual_frame_length = from_abl->mBuffers[0].mDataByteSize / bytesPerFrame;
-            if (frame_length != actual_frame_length) {
-                throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) +
-                                            " : invalid frame length. frame_length(" + std::to_string(frame_length) +
-                                            ") actual_frame_length(" + std::to_string(actual_frame_length) + ")");
-            }
-        } else {
-            if (to_abl->mBuffers[to_ch_idx].mData == nullptr) {
-                uint32_t const size = bytesPerFrame * frame_length;
-                if (size <= pcm_buffer_utils::_dummy_data.size()) {
-                    to_abl->mBuffers[to_ch_idx].mData = pcm_buffer_utils::_dummy_data.data();
-                    to_abl->mBuffers[to_ch_idx].mDataByteSize = size;
-                } else {
-                    throw std::overflow_error(std::string(__PRETTY_FUNCTION__) + " : buffer size is overflow(" +
-                                              std::to_string(size) + ")");
-                }
-            }
-        }
-        ++to_ch_idx;
-    }
+    map_audio_buffer_list(from_buffer.audio_buffer_list(), this->_abl.get(), channel_map.data(),
+                          static_cast<uint32_t>(channel_map.size()), format.stream_description().mBytesPerFrame,
+                          from_buffer.frame_length());
 }
 
 pcm_buffer::pcm_buffer(audio::format const &format, AudioBufferList *ptr, uint32_t const frame_capacity)
@@ -211,14 +342,23 @@ pcm_buffer::pcm_buffer(audio::format const &format, AudioBufferList *abl)
     }
 }
 
-pcm_buffer::pcm_buffer(audio::format const &format, uint32_t const frame_capacity)
+pcm_buffer::pcm_buffer(audio::format const &format, uint32_t const frame_capacity, uint32_t const alignment,
+                       audio::memory_policy const memory_policy)
     : pcm_buffer(format,
                  allocate_audio_buffer_list(format.buffer_count(), format.stride(),
-                                            frame_capacity * format.stream_description().mBytesPerFrame),
+                                            frame_capacity * format.stream_description().mBytesPerFrame, alignment,
+                                            memory_policy),
                  frame_capacity) {
     if (frame_capacity == 0) {
         throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : argument is null.");
     }
+
+    this->_alignment = alignment;
+    this->_memory_policy = memory_policy;
+    this->_buffer_capacity = format.buffer_count();
+    this->_data_byte_capacity =
+        pcm_buffer_utils::aligned_size(frame_capacity * format.stream_description().mBytesPerFrame, alignment) *
+        format.buffer_count();
 }
 
 pcm_buffer::pcm_buffer(audio::format const &format, audio::pcm_buffer const &from_buffer,
@@ -233,7 +373,11 @@ pcm_buffer::pcm_buffer(pcm_buffer &&other)
       _frame_capacity(other._frame_capacity),
       _frame_length(other._frame_length),
       _abl(std::move(other._abl)),
-      _data(std::move(other._data)) {
+      _data(std::move(other._data)),
+      _data_byte_capacity(other._data_byte_capacity),
+      _buffer_capacity(other._buffer_capacity),
+      _alignment(other._alignment),
+      _memory_policy(other._memory_policy) {
 }
 
 audio::format const &pcm_buffer::format() const {
@@ -263,6 +407,8 @@ template float *pcm_buffer::_data_ptr_at_index(uint32_t const buf_idx) const;
 template double *pcm_buffer::_data_ptr_at_index(uint32_t const buf_idx) const;
 template int32_t *pcm_buffer::_data_ptr_at_index(uint32_t const buf_idx) const;
 template int16_t *pcm_buffer::_data_ptr_at_index(uint32_t const buf_idx) const;
+template int24_t *pcm_buffer::_data_ptr_at_index(uint32_t const buf_idx) const;
+template float16_t *pcm_buffer::_data_ptr_at_index(uint32_t const buf_idx) const;
 template int8_t *pcm_buffer::_data_ptr_at_index(uint32_t const buf_idx) const;
 
 template <typename T>
@@ -297,6 +443,8 @@ template float *pcm_buffer::_data_ptr_at_channel(uint32_t const ch_idx) const;
 template double *pcm_buffer::_data_ptr_at_channel(uint32_t const ch_idx) const;
 template int32_t *pcm_buffer::_data_ptr_at_channel(uint32_t const ch_idx) const;
 template int16_t *pcm_buffer::_data_ptr_at_channel(uint32_t const ch_idx) const;
+template int24_t *pcm_buffer::_data_ptr_at_channel(uint32_t const ch_idx) const;
+template float16_t *pcm_buffer::_data_ptr_at_channel(uint32_t const ch_idx) const;
 
 template <typename T>
 T *pcm_buffer::data_ptr_at_index(uint32_t const buf_idx) {
@@ -312,6 +460,8 @@ template float *pcm_buffer::data_ptr_at_index(uint32_t const buf_idx);
 template double *pcm_buffer::data_ptr_at_index(uint32_t const buf_idx);
 template int32_t *pcm_buffer::data_ptr_at_index(uint32_t const buf_idx);
 template int16_t *pcm_buffer::data_ptr_at_index(uint32_t const buf_idx);
+template int24_t *pcm_buffer::data_ptr_at_index(uint32_t const buf_idx);
+template float16_t *pcm_buffer::data_ptr_at_index(uint32_t const buf_idx);
 
 template <typename T>
 T *pcm_buffer::data_ptr_at_channel(uint32_t const ch_idx) {
@@ -327,6 +477,8 @@ template float *pcm_buffer::data_ptr_at_channel(uint32_t const ch_idx);
 template double *pcm_buffer::data_ptr_at_channel(uint32_t const ch_idx);
 template int32_t *pcm_buffer::data_ptr_at_channel(uint32_t const ch_idx);
 template int16_t *pcm_buffer::data_ptr_at_channel(uint32_t const ch_idx);
+template int24_t *pcm_buffer::data_ptr_at_channel(uint32_t const ch_idx);
+template float16_t *pcm_buffer::data_ptr_at_channel(uint32_t const ch_idx);
 
 template <typename T>
 T const *pcm_buffer::data_ptr_at_index(uint32_t const buf_idx) const {
@@ -342,6 +494,8 @@ template float const *pcm_buffer::data_ptr_at_index(uint32_t const buf_idx) cons
 template double const *pcm_buffer::data_ptr_at_index(uint32_t const buf_idx) const;
 template int32_t const *pcm_buffer::data_ptr_at_index(uint32_t const buf_idx) const;
 template int16_t const *pcm_buffer::data_ptr_at_index(uint32_t const buf_idx) const;
+template int24_t const *pcm_buffer::data_ptr_at_index(uint32_t const buf_idx) const;
+template float16_t const *pcm_buffer::data_ptr_at_index(uint32_t const buf_idx) const;
 
 template <typename T>
 T const *pcm_buffer::data_ptr_at_channel(uint32_t const ch_idx) const {
@@ -357,6 +511,8 @@ template float const *pcm_buffer::data_ptr_at_channel(uint32_t const ch_idx) con
 template double const *pcm_buffer::data_ptr_at_channel(uint32_t const ch_idx) const;
 template int32_t const *pcm_buffer::data_ptr_at_channel(uint32_t const ch_idx) const;
 template int16_t const *pcm_buffer::data_ptr_at_channel(uint32_t const ch_idx) const;
+template int24_t const *pcm_buffer::data_ptr_at_channel(uint32_t const ch_idx) const;
+template float16_t const *pcm_buffer::data_ptr_at_channel(uint32_t const ch_idx) const;
 
 uint32_t pcm_buffer::frame_capacity() const {
     return this->_frame_capacity;
@@ -379,6 +535,47 @@ void pcm_buffer::set_frame_length(uint32_t const length) {
     set_data_byte_size(*this, data_byte_size);
 }
 
+void pcm_buffer::reconfigure(audio::format const &format, uint32_t const frame_capacity) {
+    if (!this->_data) {
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " : buffer does not own its data.");
+    }
+
+    if (frame_capacity == 0) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : frame_capacity is zero.");
+    }
+
+    uint32_t const buffer_count = format.buffer_count();
+    uint32_t const data_byte_size = frame_capacity * format.stream_description().mBytesPerFrame;
+    std::size_t const plane_size = pcm_buffer_utils::aligned_size(data_byte_size, this->_alignment);
+    std::size_t const required_byte_count = plane_size * buffer_count;
+
+    if (buffer_count > this->_buffer_capacity || required_byte_count > this->_data_byte_capacity) {
+        std::size_t const grown_byte_count = std::max(required_byte_count, this->_data_byte_capacity * 2);
+        std::size_t const grown_plane_size =
+            pcm_buffer_utils::aligned_size(grown_byte_count / buffer_count, this->_alignment);
+        auto abl_pair = allocate_audio_buffer_list(buffer_count, format.stride(),
+                                                   static_cast<uint32_t>(grown_plane_size), this->_alignment,
+                                                   this->_memory_policy);
+        this->_abl = std::move(abl_pair.first);
+        this->_data = std::move(abl_pair.second);
+        this->_abl_ptr = this->_abl.get();
+        this->_data_byte_capacity = grown_plane_size * buffer_count;
+        this->_buffer_capacity = buffer_count;
+    }
+
+    this->_abl->mNumberBuffers = buffer_count;
+
+    for (uint32_t buf_idx = 0; buf_idx < buffer_count; ++buf_idx) {
+        AudioBuffer &buffer = this->_abl->mBuffers[buf_idx];
+        buffer.mNumberChannels = format.stride();
+        buffer.mData = &this->_data.get()[plane_size * buf_idx];
+    }
+
+    this->_format = format;
+    this->_frame_capacity = frame_capacity;
+    this->reset_buffer();
+}
+
 void pcm_buffer::reset_buffer() {
     this->set_frame_length(frame_capacity());
     audio::clear(this->audio_buffer_list());
@@ -402,25 +599,87 @@ void pcm_buffer::clear(uint32_t const begin_frame, uint32_t const length) {
     }
 }
 
+void pcm_buffer::apply_gain(double const gain) {
+    this->apply_gain_ramp(gain, gain);
+}
+
+void pcm_buffer::apply_gain_ramp(double const gain_start, double const gain_end) {
+    pcm_format const pcm_format = this->_format.pcm_format();
+
+    if (pcm_format != pcm_format::float32 && pcm_format != pcm_format::float64) {
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " : invalid pcm_format.");
+    }
+
+    AudioBufferList *const abl = this->audio_buffer_list();
+
+    if (gain_start == gain_end || !this->_format.is_interleaved()) {
+        for (uint32_t buf_idx = 0; buf_idx < abl->mNumberBuffers; ++buf_idx) {
+            audio::apply_gain(abl->mBuffers[buf_idx].mData, 1, pcm_format,
+                              this->_frame_length * abl->mBuffers[buf_idx].mNumberChannels, gain_start, gain_end);
+        }
+    } else {
+        uint32_t const sample_byte_count = this->_format.sample_byte_count();
+        for (uint32_t ch_idx = 0; ch_idx < this->_format.channel_count(); ++ch_idx) {
+            abl_channel const channel = get_abl_channel(abl, ch_idx, sample_byte_count);
+            audio::apply_gain(channel.data, channel.stride, pcm_format, this->_frame_length, gain_start, gain_end);
+        }
+    }
+}
+
 bool pcm_buffer::is_empty() const {
-    uint32_t const frame_size = this->_format.frame_byte_count();
-    int8_t zero_data[frame_size];
-    memset(zero_data, 0, frame_size);
-
-    auto buffer_each = make_fast_each(this->_format.buffer_count());
-    while (yas_each_next(buffer_each)) {
-        int8_t const *data = this->_data_ptr_at_index<int8_t>(yas_each_index(buffer_each));
-
-        auto frame_each = make_fast_each(this->_frame_length);
-        while (yas_each_next(frame_each)) {
-            if (memcmp(&data[yas_each_index(frame_each) * frame_size], zero_data, frame_size) != 0) {
-                return false;
-            }
+    if (this->_frame_length == 0) {
+        return true;
+    }
+
+    AudioBufferList const *const abl = this->audio_buffer_list();
+    uint32_t const sample_byte_count = this->_format.sample_byte_count();
+
+    for (uint32_t buf_idx = 0; buf_idx < abl->mNumberBuffers; ++buf_idx) {
+        AudioBuffer const &buffer = abl->mBuffers[buf_idx];
+        if (!audio::is_zero(buffer.mData, this->_frame_length * buffer.mNumberChannels * sample_byte_count)) {
+            return false;
         }
     }
     return true;
 }
 
+bool pcm_buffer::is_silent(double const threshold) const {
+    if (this->_frame_length == 0) {
+        return true;
+    }
+
+    AudioBufferList const *const abl = this->audio_buffer_list();
+    pcm_format const pcm_format = this->_format.pcm_format();
+
+    for (uint32_t buf_idx = 0; buf_idx < abl->mNumberBuffers; ++buf_idx) {
+        AudioBuffer const &buffer = abl->mBuffers[buf_idx];
+        if (!audio::is_silent(buffer.mData, 1, pcm_format, this->_frame_length * buffer.mNumberChannels, threshold)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+double pcm_buffer::peak(uint32_t const ch_idx) const {
+    if (ch_idx >= this->_format.channel_count()) {
+        throw std::out_of_range(std::string(__PRETTY_FUNCTION__) + " : out of range. ch_idx(" +
+                                std::to_string(ch_idx) + ")");
+    }
+
+    abl_channel const channel = get_abl_channel(this->audio_buffer_list(), ch_idx, this->_format.sample_byte_count());
+    return audio::peak(channel.data, channel.stride, this->_format.pcm_format(), this->_frame_length);
+}
+
+double pcm_buffer::rms(uint32_t const ch_idx) const {
+    if (ch_idx >= this->_format.channel_count()) {
+        throw std::out_of_range(std::string(__PRETTY_FUNCTION__) + " : out of range. ch_idx(" +
+                                std::to_string(ch_idx) + ")");
+    }
+
+    abl_channel const channel = get_abl_channel(this->audio_buffer_list(), ch_idx, this->_format.sample_byte_count());
+    return audio::rms(channel.data, channel.stride, this->_format.pcm_format(), this->_frame_length);
+}
+
 pcm_buffer::copy_result pcm_buffer::copy_from(pcm_buffer const &from_buffer) {
     return this->copy_from(from_buffer, {});
 }
@@ -446,6 +705,108 @@ pcm_buffer::copy_result pcm_buffer::copy_from(pcm_buffer const &from_buffer, cop
     return result;
 }
 
+pcm_buffer::copy_result pcm_buffer::convert_from(pcm_buffer const &from_buffer) {
+    return this->convert_from(from_buffer, {});
+}
+
+pcm_buffer::copy_result pcm_buffer::convert_from(pcm_buffer const &from_buffer, convert_options args) {
+    audio::format const &from_format = from_buffer.format();
+    audio::format const &to_format = this->format();
+
+    if (from_format.channel_count() != to_format.channel_count() || from_format.pcm_format() == pcm_format::other ||
+        to_format.pcm_format() == pcm_format::other) {
+        return copy_result(copy_error_t::invalid_format);
+    }
+
+    if (from_format.pcm_format() == to_format.pcm_format() && !args.dither) {
+        return this->copy_from(from_buffer,
+                               {.from_begin_frame = args.from_begin_frame,
+                                .to_begin_frame = args.to_begin_frame,
+                                .length = args.length});
+    }
+
+    bool const is_whole = args.from_begin_frame == 0 && args.to_begin_frame == 0 && args.length == 0;
+    uint32_t const from_frame_length = from_buffer.frame_length();
+    uint32_t const to_frame_length = this->frame_length();
+
+    if (args.from_begin_frame > from_frame_length) {
+        return copy_result(copy_error_t::out_of_range_frame);
+    }
+
+    uint32_t const length = args.length ?: (from_frame_length - args.from_begin_frame);
+
+    if (args.from_begin_frame + length > from_frame_length || args.to_begin_frame + length > to_frame_length) {
+        return copy_result(copy_error_t::out_of_range_frame);
+    }
+
+    if (length == 0) {
+        return copy_result(length);
+    }
+
+    AudioBufferList const *const from_abl = from_buffer.audio_buffer_list();
+    AudioBufferList const *const to_abl = this->audio_buffer_list();
+    uint32_t const from_sample_byte_count = from_format.sample_byte_count();
+    uint32_t const to_sample_byte_count = to_format.sample_byte_count();
+
+    for (uint32_t ch_idx = 0; ch_idx < from_format.channel_count(); ++ch_idx) {
+        abl_channel const from_channel = get_abl_channel(from_abl, ch_idx, from_sample_byte_count);
+        abl_channel const to_channel = get_abl_channel(to_abl, ch_idx, to_sample_byte_count);
+
+        audio::convert(&from_channel.data[args.from_begin_frame * from_channel.stride * from_sample_byte_count],
+                       from_channel.stride, from_format.pcm_format(),
+                       &to_channel.data[args.to_begin_frame * to_channel.stride * to_sample_byte_count],
+                       to_channel.stride, to_format.pcm_format(), length, args.dither);
+    }
+
+    if (is_whole) {
+        this->set_frame_length(length);
+    }
+
+    return copy_result(length);
+}
+
+pcm_buffer::copy_result pcm_buffer::add_from(pcm_buffer const &from_buffer, double const gain) {
+    return this->add_from_with_ramp(from_buffer, gain, gain);
+}
+
+pcm_buffer::copy_result pcm_buffer::add_from_with_ramp(pcm_buffer const &from_buffer, double const gain_start,
+                                                       double const gain_end) {
+    audio::format const &from_format = from_buffer.format();
+    audio::format const &to_format = this->format();
+    pcm_format const pcm_format = to_format.pcm_format();
+
+    if (from_format.pcm_format() != pcm_format || from_format.channel_count() != to_format.channel_count() ||
+        (pcm_format != pcm_format::float32 && pcm_format != pcm_format::float64)) {
+        return copy_result(copy_error_t::invalid_format);
+    }
+
+    uint32_t const length = from_buffer.frame_length();
+
+    if (length > this->frame_length()) {
+        return copy_result(copy_error_t::out_of_range_frame);
+    }
+
+    AudioBufferList const *const from_abl = from_buffer.audio_buffer_list();
+    AudioBufferList *const to_abl = this->audio_buffer_list();
+
+    if (gain_start == gain_end && is_equal_layout(from_abl, to_abl)) {
+        for (uint32_t buf_idx = 0; buf_idx < to_abl->mNumberBuffers; ++buf_idx) {
+            audio::add_with_gain(from_abl->mBuffers[buf_idx].mData, 1, to_abl->mBuffers[buf_idx].mData, 1, pcm_format,
+                                 length * to_abl->mBuffers[buf_idx].mNumberChannels, gain_start, gain_end);
+        }
+    } else {
+        uint32_t const sample_byte_count = to_format.sample_byte_count();
+        for (uint32_t ch_idx = 0; ch_idx < to_format.channel_count(); ++ch_idx) {
+            abl_channel const from_channel = get_abl_channel(from_abl, ch_idx, sample_byte_count);
+            abl_channel const to_channel = get_abl_channel(to_abl, ch_idx, sample_byte_count);
+            audio::add_with_gain(from_channel.data, from_channel.stride, to_channel.data, to_channel.stride,
+                                 pcm_format, length, gain_start, gain_end);
+        }
+    }
+
+    return copy_result(length);
+}
+
 pcm_buffer::copy_result pcm_buffer::copy_channel_from(pcm_buffer const &from_buffer) {
     return this->copy_channel_from(from_buffer, {});
 }
@@ -499,6 +860,14 @@ pcm_buffer::copy_result pcm_buffer::copy_channel_from(pcm_buffer const &from_buf
             from_ptr = &from_buffer.data_ptr_at_channel<int32_t>(args.from_channel)[from_idx];
             to_ptr = &this->data_ptr_at_channel<int32_t>(args.to_channel)[to_idx];
             break;
+        case pcm_format::int24:
+            from_ptr = &from_buffer.data_ptr_at_channel<int24_t>(args.from_channel)[from_idx];
+            to_ptr = &this->data_ptr_at_channel<int24_t>(args.to_channel)[to_idx];
+            break;
+        case pcm_format::float16:
+            from_ptr = &from_buffer.data_ptr_at_channel<float16_t>(args.from_channel)[from_idx];
+            to_ptr = &this->data_ptr_at_channel<float16_t>(args.to_channel)[to_idx];
+            break;
         default:
             throw std::runtime_error("invalid pcm_format");
     }
@@ -550,7 +919,7 @@ pcm_buffer::copy_result pcm_buffer::copy_from(T const *const from_data, uint32_t
         return pcm_buffer::copy_result(to_result.error());
     }
 
-    abl_info to_info = to_result.value();
+    abl_info const &to_info = to_result.value();
 
     if ((to_begin_frame + copy_length) > to_info.frame_length) {
         return pcm_buffer::copy_result(pcm_buffer::copy_error_t::out_of_range_frame);
@@ -560,8 +929,9 @@ pcm_buffer::copy_result pcm_buffer::copy_from(T const *const from_data, uint32_t
         return pcm_buffer::copy_result(pcm_buffer::copy_error_t::out_of_range_frame);
     }
 
-    uint32_t const &to_stride = to_info.strides[to_ch_idx];
-    void *const to_data = &(to_info.datas[to_ch_idx][to_begin_frame * sample_byte_count * to_stride]);
+    abl_channel const to_channel = get_abl_channel(to_abl, to_ch_idx, sample_byte_count);
+    uint32_t const to_stride = to_channel.stride;
+    void *const to_data = &(to_channel.data[to_begin_frame * sample_byte_count * to_stride]);
     void const *const from_data_at_begin = &(from_data[from_begin_frame * sample_byte_count * from_stride]);
 
     copy(from_data_at_begin, from_stride, to_data, to_stride, copy_length, sample_byte_count);
@@ -577,6 +947,10 @@ template pcm_buffer::copy_result pcm_buffer::copy_from(int32_t const *const, uin
                                                        uint32_t const, uint32_t const, uint32_t const);
 template pcm_buffer::copy_result pcm_buffer::copy_from(int16_t const *const, uint32_t const, uint32_t const,
                                                        uint32_t const, uint32_t const, uint32_t const);
+template pcm_buffer::copy_result pcm_buffer::copy_from(int24_t const *const, uint32_t const, uint32_t const,
+                                                       uint32_t const, uint32_t const, uint32_t const);
+template pcm_buffer::copy_result pcm_buffer::copy_from(float16_t const *const, uint32_t const, uint32_t const,
+                                                       uint32_t const, uint32_t const, uint32_t const);
 
 template <typename T>
 pcm_buffer::copy_result pcm_buffer::copy_to(T *const to_data, uint32_t const to_stride, uint32_t const to_begin_frame,
@@ -600,8 +974,13 @@ pcm_buffer::copy_result pcm_buffer::copy_to(T *const to_data, uint32_t const to_
         return pcm_buffer::copy_result(pcm_buffer::copy_error_t::out_of_range_frame);
     }
 
-    uint32_t const &from_stride = from_info.strides[from_ch_idx];
-    void const *from_data = &(from_info.datas[from_ch_idx][from_begin_frame * sample_byte_count * from_stride]);
+    if (from_info.channel_count <= from_ch_idx) {
+        return pcm_buffer::copy_result(pcm_buffer::copy_error_t::out_of_range_channel);
+    }
+
+    abl_channel const from_channel = get_abl_channel(from_abl, from_ch_idx, sample_byte_count);
+    uint32_t const from_stride = from_channel.stride;
+    void const *from_data = &(from_channel.data[from_begin_frame * sample_byte_count * from_stride]);
     void *to_data_at_begin = &(to_data[to_begin_frame * sample_byte_count * to_stride]);
 
     audio::copy(from_data, from_stride, to_data_at_begin, to_stride, copy_length, sample_byte_count);
@@ -617,6 +996,10 @@ template pcm_buffer::copy_result pcm_buffer::copy_to(int32_t *const, uint32_t co
                                                      uint32_t const, uint32_t const) const;
 template pcm_buffer::copy_result pcm_buffer::copy_to(int16_t *const, uint32_t const, uint32_t const, uint32_t const,
                                                      uint32_t const, uint32_t const) const;
+template pcm_buffer::copy_result pcm_buffer::copy_to(int24_t *const, uint32_t const, uint32_t const, uint32_t const,
+                                                     uint32_t const, uint32_t const) const;
+template pcm_buffer::copy_result pcm_buffer::copy_to(float16_t *const, uint32_t const, uint32_t const, uint32_t const,
+                                                     uint32_t const, uint32_t const) const;
 
 #pragma mark - global
 
@@ -641,22 +1024,28 @@ void audio::copy(void const *const from_data, uint32_t const from_stride, void *
     if (from_stride == 1 && to_stride == 1) {
         memcpy(to_data, from_data, copy_length * sample_byte_count);
     } else {
-        if (sample_byte_count == sizeof(float)) {
-            float const *const from_float32_data = static_cast<float const *>(from_data);
-            float *const to_float_data = static_cast<float *>(to_data);
-            cblas_scopy(copy_length, from_float32_data, from_stride, to_float_data, to_stride);
-        } else if (sample_byte_count == sizeof(double)) {
-            double const *const from_float64_data = static_cast<double const *>(from_data);
-            double *const to_float64_data = static_cast<double *>(to_data);
-            cblas_dcopy(copy_length, from_float64_data, from_stride, to_float64_data, to_stride);
-        } else {
-            for (uint32_t frame = 0; frame < copy_length; ++frame) {
-                uint32_t const sample_frame = frame * sample_byte_count;
+        switch (sample_byte_count) {
+            case sizeof(uint16_t):
+                copy_strided(static_cast<uint16_t const *>(from_data), from_stride, static_cast<uint16_t *>(to_data),
+                             to_stride, copy_length);
+                break;
+            case sizeof(uint32_t):
+                copy_strided(static_cast<uint32_t const *>(from_data), from_stride, static_cast<uint32_t *>(to_data),
+                             to_stride, copy_length);
+                break;
+            case sizeof(uint64_t):
+                copy_strided(static_cast<uint64_t const *>(from_data), from_stride, static_cast<uint64_t *>(to_data),
+                             to_stride, copy_length);
+                break;
+            default: {
                 uint8_t const *const from_byte_data = static_cast<uint8_t const *>(from_data);
                 uint8_t *const to_byte_data = static_cast<uint8_t *>(to_data);
-                memcpy(&to_byte_data[sample_frame * to_stride], &from_byte_data[sample_frame * from_stride],
-                       sample_byte_count);
-            }
+                for (uint32_t frame = 0; frame < copy_length; ++frame) {
+                    uint32_t const sample_frame = frame * sample_byte_count;
+                    memcpy(&to_byte_data[sample_frame * to_stride], &from_byte_data[sample_frame * from_stride],
+                           sample_byte_count);
+                }
+            } break;
         }
     }
 }
@@ -674,8 +1063,8 @@ pcm_buffer::copy_result audio::copy(AudioBufferList const *const from_abl, Audio
         return pcm_buffer::copy_result(to_result.error());
     }
 
-    abl_info from_info = from_result.value();
-    abl_info to_info = to_result.value();
+    abl_info const &from_info = from_result.value();
+    abl_info const &to_info = to_result.value();
 
     uint32_t const copy_length = length ?: (from_info.frame_length - from_begin_frame);
 
@@ -688,11 +1077,62 @@ pcm_buffer::copy_result audio::copy(AudioBufferList const *const from_abl, Audio
         return pcm_buffer::copy_result(pcm_buffer::copy_error_t::out_of_range_channel);
     }
 
-    for (uint32_t ch_idx = 0; ch_idx < from_info.channel_count; ch_idx++) {
-        uint32_t const &from_stride = from_info.strides[ch_idx];
-        uint32_t const &to_stride = to_info.strides[ch_idx];
-        void const *from_data = &(from_info.datas[ch_idx][from_begin_frame * sample_byte_count * from_stride]);
-        void *to_data = &(to_info.datas[ch_idx][to_begin_frame * sample_byte_count * to_stride]);
+    if (copy_length == 0) {
+        return pcm_buffer::copy_result(copy_length);
+    }
+
+    if (is_equal_layout(from_abl, to_abl)) {
+        for (uint32_t buf_idx = 0; buf_idx < from_abl->mNumberBuffers; ++buf_idx) {
+            uint32_t const frame_byte_count = from_abl->mBuffers[buf_idx].mNumberChannels * sample_byte_count;
+            uint8_t const *const from_data = static_cast<uint8_t const *>(from_abl->mBuffers[buf_idx].mData);
+            uint8_t *const to_data = static_cast<uint8_t *>(to_abl->mBuffers[buf_idx].mData);
+
+            memcpy(&to_data[to_begin_frame * frame_byte_count], &from_data[from_begin_frame * frame_byte_count],
+                   copy_length * frame_byte_count);
+        }
+
+        return pcm_buffer::copy_result(copy_length);
+    }
+
+    uint32_t const channel_count = from_info.channel_count;
+
+    if (channel_count <= interleave_channel_count_max) {
+        if (from_abl->mNumberBuffers == 1 && is_non_interleaved(to_abl)) {
+            uint8_t const *const from_data = static_cast<uint8_t const *>(from_abl->mBuffers[0].mData);
+            void *to_datas[interleave_channel_count_max];
+            for (uint32_t ch_idx = 0; ch_idx < channel_count; ++ch_idx) {
+                uint8_t *const to_data = static_cast<uint8_t *>(to_abl->mBuffers[ch_idx].mData);
+                to_datas[ch_idx] = &to_data[to_begin_frame * sample_byte_count];
+            }
+
+            deinterleave(&from_data[from_begin_frame * channel_count * sample_byte_count], to_datas, channel_count,
+                         copy_length, sample_byte_count);
+
+            return pcm_buffer::copy_result(copy_length);
+        } else if (is_non_interleaved(from_abl) && to_abl->mNumberBuffers == 1 &&
+                   to_abl->mBuffers[0].mNumberChannels == channel_count) {
+            void const *from_datas[interleave_channel_count_max];
+            for (uint32_t ch_idx = 0; ch_idx < channel_count; ++ch_idx) {
+                uint8_t const *const from_data = static_cast<uint8_t const *>(from_abl->mBuffers[ch_idx].mData);
+                from_datas[ch_idx] = &from_data[from_begin_frame * sample_byte_count];
+            }
+            uint8_t *const to_data = static_cast<uint8_t *>(to_abl->mBuffers[0].mData);
+
+            interleave(from_datas, &to_data[to_begin_frame * channel_count * sample_byte_count], channel_count,
+                       copy_length, sample_byte_count);
+
+            return pcm_buffer::copy_result(copy_length);
+        }
+    }
+
+    abl_channel_each from_each(from_abl, sample_byte_count);
+    abl_channel_each to_each(to_abl, sample_byte_count);
+
+    while (from_each.next() && to_each.next()) {
+        uint32_t const from_stride = from_each.channel.stride;
+        uint32_t const to_stride = to_each.channel.stride;
+        void const *from_data = &(from_each.channel.data[from_begin_frame * sample_byte_count * from_stride]);
+        void *to_data = &(to_each.channel.data[to_begin_frame * sample_byte_count * to_stride]);
 
         copy(from_data, from_stride, to_data, to_stride, copy_length, sample_byte_count);
     }
@@ -24,6 +24,13 @@ struct pcm_buffer final {
         uint32_t const length = 0;
     };
 
+    struct convert_options {
+        uint32_t const from_begin_frame = 0;
+        uint32_t const to_begin_frame = 0;
+        uint32_t const length = 0;
+        bool const dither = false;
+    };
+
     struct copy_channel_options {
         uint32_t const from_begin_frame = 0;
         uint32_t const from_channel = 0;
@@ -42,8 +49,12 @@ struct pcm_buffer final {
 
     using copy_result = result<uint32_t, copy_error_t>;
 
+    static uint32_t constexpr default_alignment = 64;
+
     pcm_buffer(audio::format const &format, AudioBufferList *abl);
-    pcm_buffer(audio::format const &format, uint32_t const frame_capacity);
+    pcm_buffer(audio::format const &format, uint32_t const frame_capacity,
+               uint32_t const alignment = default_alignment,
+               audio::memory_policy const memory_policy = audio::memory_policy::standard);
     pcm_buffer(audio::format const &format, pcm_buffer const &from_buffer, channel_map_t const &channel_map);
 
     pcm_buffer(pcm_buffer &&);
@@ -65,14 +76,26 @@ struct pcm_buffer final {
     [[nodiscard]] uint32_t frame_length() const;
     void set_frame_length(uint32_t const length);
 
+    void reconfigure(audio::format const &format, uint32_t const frame_capacity);
+
     void reset_buffer();
     void clear();
     void clear(uint32_t const begin_frame, uint32_t const length);
 
     bool is_empty() const;
+    void apply_gain(double const gain);
+    void apply_gain_ramp(double const gain_start, double const gain_end);
+
+    [[nodiscard]] bool is_silent(double const threshold = 0.0) const;
+    [[nodiscard]] double peak(uint32_t const ch_idx) const;
+    [[nodiscard]] double rms(uint32_t const ch_idx) const;
 
     pcm_buffer::copy_result copy_from(pcm_buffer const &);
     pcm_buffer::copy_result copy_from(pcm_buffer const &, copy_options);
+    pcm_buffer::copy_result convert_from(pcm_buffer const &);
+    pcm_buffer::copy_result convert_from(pcm_buffer const &, convert_options);
+    pcm_buffer::copy_result add_from(pcm_buffer const &, double const gain = 1.0);
+    pcm_buffer::copy_result add_from_with_ramp(pcm_buffer const &, double const gain_start, double const gain_end);
     pcm_buffer::copy_result copy_channel_from(pcm_buffer const &);
     pcm_buffer::copy_result copy_channel_from(pcm_buffer const &, copy_channel_options);
     pcm_buffer::copy_result copy_from(AudioBufferList const *const from_abl, uint32_t const from_begin_frame = 0,
@@ -92,10 +115,14 @@ struct pcm_buffer final {
    private:
     audio::format _format;
     AudioBufferList *_abl_ptr;
-    uint32_t const _frame_capacity;
+    uint32_t _frame_capacity;
     uint32_t _frame_length;
     abl_uptr _abl;
     abl_data_uptr _data;
+    std::size_t _data_byte_capacity = 0;
+    uint32_t _buffer_capacity = 0;
+    uint32_t _alignment = default_alignment;
+    audio::memory_policy _memory_policy = audio::memory_policy::standard;
 
     pcm_buffer(audio::format const &format, std::pair<audio::abl_uptr, audio::abl_data_uptr> &&abl_pair,
                uint32_t const frame_capacity);
@@ -130,7 +157,14 @@ pcm_buffer::copy_result copy(AudioBufferList const *const from_abl, AudioBufferL
 uint32_t frame_length(AudioBufferList const *const abl, uint32_t const sample_byte_count);
 
 std::pair<abl_uptr, abl_data_uptr> allocate_audio_buffer_list(uint32_t const buffer_count, uint32_t const channel_count,
-                                                              uint32_t const size = 0);
+                                                              uint32_t const size = 0,
+                                                              uint32_t const alignment = pcm_buffer::default_alignment,
+                                                              memory_policy const policy = memory_policy::standard);
+void map_audio_buffer_list(AudioBufferList const *const from_abl, AudioBufferList *const to_abl,
+                           uint32_t const *const channel_map, uint32_t const channel_count,
+                           uint32_t const bytes_per_frame, uint32_t const frame_length);
+void slice_audio_buffer_list(AudioBufferList const *const from_abl, AudioBufferList *const to_abl,
+                             uint32_t const sample_byte_count, uint32_t const begin_frame, uint32_t const length);
 bool is_equal_structure(AudioBufferList const &abl1, AudioBufferList const &abl2);
 }  // namespace yas::audio
 
@@ -0,0 +1,379 @@
+//
+//  yas_audio_pcm_buffer_pool.cpp
+//
+
+#include "yas_audio_pcm_buffer_pool.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <string>
+#include <type_traits>
+
+using namespace yas;
+using namespace yas::audio;
+
+namespace yas::audio::pcm_buffer_pool_utils {
+static uint32_t constexpr null_index = UINT32_MAX;
+static std::size_t constexpr segment_count = 32;
+
+static uint64_t make_head(uint32_t const tag, uint32_t const index) {
+    return (static_cast<uint64_t>(tag) << 32) | index;
+}
+
+static uint32_t head_tag(uint64_t const head) {
+    return static_cast<uint32_t>(head >> 32);
+}
+
+static uint32_t head_index(uint64_t const head) {
+    return static_cast<uint32_t>(head);
+}
+
+static std::size_t segment_index(std::size_t const index) {
+    return static_cast<std::size_t>(63 - __builtin_clzll(static_cast<unsigned long long>(index) + 1));
+}
+
+static std::size_t segment_first_index(std::size_t const segment) {
+    return (static_cast<std::size_t>(1) << segment) - 1;
+}
+
+// segment n holds 2^n elements, so the elements never move while it grows on the main thread
+template <typename T>
+struct segmented_vector {
+    segmented_vector() = default;
+
+    ~segmented_vector() {
+        std::size_t const size = this->size();
+        for (std::size_t idx = 0; idx < size; ++idx) {
+            this->at(idx).~T();
+        }
+
+        for (auto &segment : this->_segments) {
+            delete[] segment.load();
+        }
+    }
+
+    [[nodiscard]] std::size_t size() const {
+        return this->_size.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] T &at(std::size_t const index) const {
+        std::size_t const segment = segment_index(index);
+        storage_t *const storage = this->_segments[segment].load(std::memory_order_acquire);
+        return *std::launder(reinterpret_cast<T *>(&storage[index - segment_first_index(segment)]));
+    }
+
+    template <typename... Args>
+    T &emplace_back(Args &&... args) {
+        std::size_t const index = this->_size.load(std::memory_order_relaxed);
+
+        if (index >= null_index) {
+            throw std::overflow_error(std::string(__PRETTY_FUNCTION__) + " : too many elements.");
+        }
+
+        std::size_t const segment = segment_index(index);
+        storage_t *storage = this->_segments[segment].load(std::memory_order_relaxed);
+
+        if (!storage) {
+            storage = new storage_t[static_cast<std::size_t>(1) << segment];
+            this->_segments[segment].store(storage, std::memory_order_release);
+        }
+
+        T *const element = new (&storage[index - segment_first_index(segment)]) T(std::forward<Args>(args)...);
+        this->_size.store(index + 1, std::memory_order_release);
+        return *element;
+    }
+
+    [[nodiscard]] std::optional<std::size_t> index_of(void const *const element) const {
+        auto const address = reinterpret_cast<std::uintptr_t>(element);
+
+        for (std::size_t segment = 0; segment < segment_count; ++segment) {
+            storage_t const *const storage = this->_segments[segment].load(std::memory_order_acquire);
+            if (!storage) {
+                break;
+            }
+
+            auto const begin = reinterpret_cast<std::uintptr_t>(storage);
+            auto const end = begin + (sizeof(storage_t) << segment);
+
+            if (begin <= address && address < end) {
+                std::size_t const index = segment_first_index(segment) + (address - begin) / sizeof(storage_t);
+                if (index < this->size()) {
+                    return index;
+                }
+                break;
+            }
+        }
+
+        return std::nullopt;
+    }
+
+   private:
+    using storage_t = std::aligned_storage_t<sizeof(T), alignof(T)>;
+
+    std::array<std::atomic<storage_t *>, segment_count> _segments{};
+    std::atomic<std::size_t> _size{0};
+
+    segmented_vector(segmented_vector const &) = delete;
+    segmented_vector(segmented_vector &&) = delete;
+    segmented_vector &operator=(segmented_vector const &) = delete;
+    segmented_vector &operator=(segmented_vector &&) = delete;
+};
+}  // namespace yas::audio::pcm_buffer_pool_utils
+
+#pragma mark - entry
+
+struct pcm_buffer_pool::entry {
+    audio::format const format;
+    uint32_t const frame_capacity;
+
+    // the buffers beyond the reservation are destroyed and their slots are reused by later reservations
+    pcm_buffer_pool_utils::segmented_vector<std::optional<pcm_buffer>> buffers;
+    pcm_buffer_pool_utils::segmented_vector<std::atomic<uint32_t>> next_indices;
+    std::vector<uint32_t> vacant_indices;
+    std::size_t reserved_count = 0;
+    std::size_t buffer_count = 0;
+    std::atomic<uint64_t> head{pcm_buffer_pool_utils::make_head(0, pcm_buffer_pool_utils::null_index)};
+    std::atomic<std::size_t> in_use_count{0};
+    std::atomic<std::size_t> high_water_mark{0};
+    std::atomic<std::size_t> exhausted_count{0};
+
+    entry(audio::format const &format, uint32_t const frame_capacity)
+        : format(format), frame_capacity(frame_capacity) {
+    }
+
+    void add_reservation(std::size_t const count) {
+        if (count >= pcm_buffer_pool_utils::null_index - this->reserved_count) {
+            throw std::overflow_error(std::string(__PRETTY_FUNCTION__) + " : too many buffers.");
+        }
+
+        this->reserved_count += count;
+
+        while (this->buffer_count < this->reserved_count) {
+            uint32_t index;
+
+            if (this->vacant_indices.empty()) {
+                index = static_cast<uint32_t>(this->buffers.size());
+                this->buffers.emplace_back(std::in_place, this->format, this->frame_capacity);
+                this->next_indices.emplace_back(pcm_buffer_pool_utils::null_index);
+            } else {
+                index = this->vacant_indices.back();
+                this->vacant_indices.pop_back();
+                this->buffers.at(index).emplace(this->format, this->frame_capacity);
+            }
+
+            ++this->buffer_count;
+            this->_push(index);
+        }
+
+        this->trim();
+    }
+
+    void remove_reservation(std::size_t const count) {
+        if (this->reserved_count < count) {
+            throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : count exceeds the reservation.");
+        }
+
+        this->reserved_count -= count;
+
+        this->trim();
+    }
+
+    // buffers in use when the reservation shrinks are destroyed by a later trim after they are released
+    void trim() {
+        while (this->reserved_count < this->buffer_count) {
+            auto const index = this->_pop();
+            if (!index) {
+                break;
+            }
+
+            this->buffers.at(index.value()).reset();
+            this->vacant_indices.push_back(index.value());
+            --this->buffer_count;
+        }
+    }
+
+    pcm_buffer *acquire() {
+        if (auto const index = this->_pop()) {
+            this->_update_high_water_mark(this->in_use_count.fetch_add(1, std::memory_order_relaxed) + 1);
+
+            pcm_buffer &buffer = *this->buffers.at(index.value());
+            buffer.set_frame_length(buffer.frame_capacity());
+            return &buffer;
+        } else {
+            this->exhausted_count.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+    }
+
+    void release(pcm_buffer *const buffer) {
+        auto const index = this->buffers.index_of(buffer);
+
+        if (!index || !this->buffers.at(index.value()) || &*this->buffers.at(index.value()) != buffer) {
+            throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : buffer is not in pool.");
+        }
+
+        this->_push(static_cast<uint32_t>(index.value()));
+        this->in_use_count.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+   private:
+    std::optional<uint32_t> _pop() {
+        uint64_t head = this->head.load(std::memory_order_acquire);
+
+        while (true) {
+            uint32_t const index = pcm_buffer_pool_utils::head_index(head);
+
+            if (index == pcm_buffer_pool_utils::null_index) {
+                return std::nullopt;
+            }
+
+            uint32_t const next_index = this->next_indices.at(index).load(std::memory_order_relaxed);
+            uint64_t const new_head =
+                pcm_buffer_pool_utils::make_head(pcm_buffer_pool_utils::head_tag(head) + 1, next_index);
+
+            if (this->head.compare_exchange_weak(head, new_head, std::memory_order_acq_rel,
+                                                 std::memory_order_acquire)) {
+                return index;
+            }
+        }
+    }
+
+    void _push(uint32_t const index) {
+        uint64_t head = this->head.load(std::memory_order_relaxed);
+
+        while (true) {
+            this->next_indices.at(index).store(pcm_buffer_pool_utils::head_index(head), std::memory_order_relaxed);
+            uint64_t const new_head =
+                pcm_buffer_pool_utils::make_head(pcm_buffer_pool_utils::head_tag(head) + 1, index);
+
+            if (this->head.compare_exchange_weak(head, new_head, std::memory_order_release,
+                                                 std::memory_order_relaxed)) {
+                break;
+            }
+        }
+    }
+
+    void _update_high_water_mark(std::size_t const in_use_count) {
+        std::size_t mark = this->high_water_mark.load(std::memory_order_relaxed);
+        while (mark < in_use_count &&
+               !this->high_water_mark.compare_exchange_weak(mark, in_use_count, std::memory_order_relaxed)) {
+        }
+    }
+};
+
+struct pcm_buffer_pool::entries : pcm_buffer_pool_utils::segmented_vector<entry> {};
+
+#pragma mark - pcm_buffer_pool
+
+pcm_buffer_pool::pcm_buffer_pool() : _entries(std::make_unique<entries>()) {
+}
+
+pcm_buffer_pool::~pcm_buffer_pool() = default;
+
+pcm_buffer_pool::key_t pcm_buffer_pool::reserve(audio::format const &format, uint32_t const frame_capacity,
+                                                std::size_t const count) {
+    if (frame_capacity == 0 || count == 0) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : argument is zero.");
+    }
+
+    key_t key;
+
+    if (auto const existing = this->key(format, frame_capacity)) {
+        key = existing.value();
+    } else {
+        key = this->_entries->size();
+        this->_entries->emplace_back(format, capacity_class(frame_capacity));
+    }
+
+    this->_entries->at(key).add_reservation(count);
+
+    return key;
+}
+
+void pcm_buffer_pool::unreserve(key_t const key, std::size_t const count) {
+    if (this->_entries->size() <= key) {
+        throw std::out_of_range(std::string(__PRETTY_FUNCTION__) + " : out of range key.");
+    }
+
+    if (count == 0) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : argument is zero.");
+    }
+
+    this->_entries->at(key).remove_reservation(count);
+}
+
+std::optional<pcm_buffer_pool::key_t> pcm_buffer_pool::key(audio::format const &format,
+                                                           uint32_t const frame_capacity) const {
+    uint32_t const capacity = capacity_class(frame_capacity);
+
+    for (key_t key = 0; key < this->_entries->size(); ++key) {
+        auto const &entry = this->_entries->at(key);
+        if (entry.frame_capacity == capacity && entry.format == format) {
+            return key;
+        }
+    }
+
+    return std::nullopt;
+}
+
+pcm_buffer *pcm_buffer_pool::acquire(key_t const key) {
+    if (this->_entries->size() <= key) {
+        throw std::out_of_range(std::string(__PRETTY_FUNCTION__) + " : out of range key.");
+    }
+
+    return this->_entries->at(key).acquire();
+}
+
+void pcm_buffer_pool::release(key_t const key, pcm_buffer *const buffer) {
+    if (this->_entries->size() <= key) {
+        throw std::out_of_range(std::string(__PRETTY_FUNCTION__) + " : out of range key.");
+    }
+
+    if (!buffer) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : argument is null.");
+    }
+
+    this->_entries->at(key).release(buffer);
+}
+
+std::vector<pcm_buffer_pool::usage> pcm_buffer_pool::usages() const {
+    std::vector<usage> usages;
+    usages.reserve(this->_entries->size());
+
+    for (key_t key = 0; key < this->_entries->size(); ++key) {
+        auto const &entry = this->_entries->at(key);
+        usages.emplace_back(usage{.format = entry.format,
+                                  .frame_capacity = entry.frame_capacity,
+                                  .buffer_count = entry.buffer_count,
+                                  .high_water_mark = entry.high_water_mark.load(),
+                                  .exhausted_count = entry.exhausted_count.load()});
+    }
+
+    return usages;
+}
+
+void pcm_buffer_pool::reset_high_water_marks() {
+    for (key_t key = 0; key < this->_entries->size(); ++key) {
+        auto &entry = this->_entries->at(key);
+        entry.high_water_mark.store(entry.in_use_count.load());
+        entry.exhausted_count.store(0);
+    }
+}
+
+uint32_t pcm_buffer_pool::capacity_class(uint32_t const frame_capacity) {
+    if (frame_capacity > (1u << 31)) {
+        throw std::overflow_error(std::string(__PRETTY_FUNCTION__) + " : frame_capacity is too large.");
+    }
+
+    uint32_t capacity = 1;
+    while (capacity < frame_capacity) {
+        capacity <<= 1;
+    }
+    return capacity;
+}
+
+pcm_buffer_pool_ptr pcm_buffer_pool::make_shared() {
+    return pcm_buffer_pool_ptr(new pcm_buffer_pool{});
+}
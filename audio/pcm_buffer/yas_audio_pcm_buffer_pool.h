@@ -0,0 +1,57 @@
+//
+//  yas_audio_pcm_buffer_pool.h
+//
+
+#pragma once
+
+#include <audio/yas_audio_format.h>
+#include <audio/yas_audio_pcm_buffer.h>
+#include <audio/yas_audio_ptr.h>
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace yas::audio {
+struct pcm_buffer_pool final {
+    using key_t = std::size_t;
+
+    struct usage {
+        audio::format const format;
+        uint32_t const frame_capacity;
+        std::size_t const buffer_count;
+        std::size_t const high_water_mark;
+        std::size_t const exhausted_count;
+    };
+
+    ~pcm_buffer_pool();
+
+    key_t reserve(audio::format const &, uint32_t const frame_capacity, std::size_t const count = 1);
+    // buffers released by unreserve are destroyed on the calling thread once they are not in use
+    void unreserve(key_t const, std::size_t const count = 1);
+    [[nodiscard]] std::optional<key_t> key(audio::format const &, uint32_t const frame_capacity) const;
+
+    [[nodiscard]] pcm_buffer *acquire(key_t const);
+    void release(key_t const, pcm_buffer *const);
+
+    [[nodiscard]] std::vector<usage> usages() const;
+    void reset_high_water_marks();
+
+    [[nodiscard]] static uint32_t capacity_class(uint32_t const frame_capacity);
+
+    [[nodiscard]] static pcm_buffer_pool_ptr make_shared();
+
+   private:
+    struct entry;
+    struct entries;
+
+    std::unique_ptr<entries> const _entries;
+
+    pcm_buffer_pool();
+
+    pcm_buffer_pool(pcm_buffer_pool const &) = delete;
+    pcm_buffer_pool(pcm_buffer_pool &&) = delete;
+    pcm_buffer_pool &operator=(pcm_buffer_pool const &) = delete;
+    pcm_buffer_pool &operator=(pcm_buffer_pool &&) = delete;
+};
+}  // namespace yas::audio
@@ -0,0 +1,93 @@
+//
+//  yas_audio_pcm_buffer_view.cpp
+//
+
+#include "yas_audio_pcm_buffer_view.h"
+
+#include <string>
+
+using namespace yas;
+using namespace yas::audio;
+
+namespace yas::audio::pcm_buffer_view_utils {
+static AudioBufferList *mapped_abl(uint8_t *const storage, audio::format const &format,
+                                   pcm_buffer const &from_buffer, uint32_t const *const channel_map) {
+    auto const &from_format = from_buffer.format();
+
+    if (!channel_map || format.is_interleaved() || from_format.is_interleaved() ||
+        format.pcm_format() != from_format.pcm_format()) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : invalid format.");
+    }
+
+    if (!pcm_buffer_view::is_available(format)) {
+        throw std::overflow_error(std::string(__PRETTY_FUNCTION__) + " : buffer count is overflow(" +
+                                  std::to_string(format.buffer_count()) + ")");
+    }
+
+    AudioBufferList *const abl = reinterpret_cast<AudioBufferList *>(storage);
+
+    map_audio_buffer_list(from_buffer.audio_buffer_list(), abl, channel_map, format.buffer_count(),
+                          format.stream_description().mBytesPerFrame, from_buffer.frame_length());
+
+    return abl;
+}
+
+static AudioBufferList *sliced_abl(uint8_t *const storage, pcm_buffer const &from_buffer, uint32_t const begin_frame,
+                                   uint32_t const length) {
+    auto const &format = from_buffer.format();
+
+    if (format.buffer_count() > pcm_buffer_view::max_buffer_count) {
+        throw std::overflow_error(std::string(__PRETTY_FUNCTION__) + " : buffer count is overflow(" +
+                                  std::to_string(format.buffer_count()) + ")");
+    }
+
+    uint32_t const frame_length = from_buffer.frame_length();
+
+    if (begin_frame > frame_length || length > frame_length - begin_frame) {
+        throw std::out_of_range(std::string(__PRETTY_FUNCTION__) + " : out of range. begin_frame(" +
+                                std::to_string(begin_frame) + ") length(" + std::to_string(length) +
+                                ") frame_length(" + std::to_string(frame_length) + ")");
+    }
+
+    AudioBufferList *const abl = reinterpret_cast<AudioBufferList *>(storage);
+
+    slice_audio_buffer_list(from_buffer.audio_buffer_list(), abl, format.sample_byte_count(), begin_frame, length);
+
+    return abl;
+}
+
+static uint32_t const *validated_channel_map(audio::format const &format, channel_map_t const &channel_map) {
+    if (channel_map.size() != format.channel_count()) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : invalid channel_map size.");
+    }
+
+    return channel_map.data();
+}
+}  // namespace yas::audio::pcm_buffer_view_utils
+
+pcm_buffer_view::pcm_buffer_view(audio::format const &format, pcm_buffer const &from_buffer,
+                                 channel_map_t const &channel_map)
+    : pcm_buffer_view(format, from_buffer, pcm_buffer_view_utils::validated_channel_map(format, channel_map)) {
+}
+
+pcm_buffer_view::pcm_buffer_view(audio::format const &format, pcm_buffer const &from_buffer,
+                                 uint32_t const *const channel_map)
+    : _buffer(format, pcm_buffer_view_utils::mapped_abl(this->_abl_storage, format, from_buffer, channel_map)) {
+}
+
+pcm_buffer_view::pcm_buffer_view(pcm_buffer const &from_buffer, uint32_t const begin_frame, uint32_t const length)
+    : _buffer(from_buffer.format(),
+              pcm_buffer_view_utils::sliced_abl(this->_abl_storage, from_buffer, begin_frame, length)) {
+}
+
+pcm_buffer &pcm_buffer_view::buffer() {
+    return this->_buffer;
+}
+
+pcm_buffer const &pcm_buffer_view::buffer() const {
+    return this->_buffer;
+}
+
+bool pcm_buffer_view::is_available(audio::format const &format) {
+    return !format.is_interleaved() && format.buffer_count() <= max_buffer_count;
+}
@@ -0,0 +1,33 @@
+//
+//  yas_audio_pcm_buffer_view.h
+//
+
+#pragma once
+
+#include <audio/yas_audio_pcm_buffer.h>
+
+namespace yas::audio {
+struct pcm_buffer_view final {
+    static uint32_t constexpr max_buffer_count = inline_buffer_capacity;
+
+    pcm_buffer_view(audio::format const &format, pcm_buffer const &from_buffer, channel_map_t const &channel_map);
+    pcm_buffer_view(audio::format const &format, pcm_buffer const &from_buffer, uint32_t const *const channel_map);
+    pcm_buffer_view(pcm_buffer const &from_buffer, uint32_t const begin_frame, uint32_t const length);
+
+    [[nodiscard]] audio::pcm_buffer &buffer();
+    [[nodiscard]] audio::pcm_buffer const &buffer() const;
+
+    // whether a channel mapped view can be made for the format (non-interleaved and up to max_buffer_count buffers)
+    [[nodiscard]] static bool is_available(audio::format const &);
+
+   private:
+    alignas(AudioBufferList) uint8_t _abl_storage[sizeof(AudioBufferList) +
+                                                  sizeof(AudioBuffer) * (max_buffer_count - 1)];
+    pcm_buffer _buffer;
+
+    pcm_buffer_view(pcm_buffer_view const &) = delete;
+    pcm_buffer_view(pcm_buffer_view &&) = delete;
+    pcm_buffer_view &operator=(pcm_buffer_view const &) = delete;
+    pcm_buffer_view &operator=(pcm_buffer_view &&) = delete;
+};
+}  // namespace yas::audio
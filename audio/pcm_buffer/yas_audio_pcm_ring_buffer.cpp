@@ -0,0 +1,168 @@
+//
+//  yas_audio_pcm_ring_buffer.cpp
+//
+
+#include "yas_audio_pcm_ring_buffer.h"
+
+#include <algorithm>
+#include <string>
+
+using namespace yas;
+using namespace yas::audio;
+
+uint32_t pcm_ring_buffer::segments::length() const {
+    return this->first.length + this->second.length;
+}
+
+pcm_ring_buffer::pcm_ring_buffer(audio::format const &format, uint32_t const frame_capacity)
+    : _buffer(format, frame_capacity) {
+    if (frame_capacity == 0) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : frame_capacity is zero.");
+    }
+}
+
+audio::format const &pcm_ring_buffer::format() const {
+    return this->_buffer.format();
+}
+
+uint32_t pcm_ring_buffer::frame_capacity() const {
+    return this->_buffer.frame_capacity();
+}
+
+pcm_buffer &pcm_ring_buffer::buffer() {
+    return this->_buffer;
+}
+
+pcm_buffer const &pcm_ring_buffer::buffer() const {
+    return this->_buffer;
+}
+
+uint32_t pcm_ring_buffer::readable_frames() const {
+    uint64_t const write_position = this->_write_position.load(std::memory_order_acquire);
+    uint64_t const read_position = this->_read_position.load(std::memory_order_acquire);
+    return static_cast<uint32_t>(write_position - read_position);
+}
+
+uint32_t pcm_ring_buffer::writable_frames() const {
+    return this->frame_capacity() - this->readable_frames();
+}
+
+pcm_buffer::copy_result pcm_ring_buffer::write(pcm_buffer const &from_buffer) {
+    audio::format const &from_format = from_buffer.format();
+
+    if (from_format.pcm_format() != this->format().pcm_format() ||
+        from_format.channel_count() != this->format().channel_count()) {
+        return pcm_buffer::copy_result(pcm_buffer::copy_error_t::invalid_format);
+    }
+
+    segments const segments = this->begin_write(from_buffer.frame_length());
+
+    if (segments.first.length > 0) {
+        this->_buffer.copy_from(from_buffer, {.from_begin_frame = 0,
+                                              .to_begin_frame = segments.first.begin_frame,
+                                              .length = segments.first.length});
+    }
+
+    if (segments.second.length > 0) {
+        this->_buffer.copy_from(from_buffer, {.from_begin_frame = segments.first.length,
+                                              .to_begin_frame = segments.second.begin_frame,
+                                              .length = segments.second.length});
+    }
+
+    this->end_write(segments.length());
+
+    return pcm_buffer::copy_result(segments.length());
+}
+
+pcm_ring_buffer::segments pcm_ring_buffer::begin_write(uint32_t const length) {
+    uint32_t const writable_length = std::min(length, this->writable_frames());
+
+    if (writable_length < length) {
+        this->_overflow_frames.fetch_add(length - writable_length, std::memory_order_relaxed);
+    }
+
+    return this->_segments(this->_write_position.load(std::memory_order_relaxed), writable_length);
+}
+
+void pcm_ring_buffer::end_write(uint32_t const length) {
+    if (length > this->writable_frames()) {
+        throw std::out_of_range(std::string(__PRETTY_FUNCTION__) + " : out of range. length(" +
+                                std::to_string(length) + ")");
+    }
+
+    this->_write_position.fetch_add(length, std::memory_order_release);
+}
+
+pcm_buffer::copy_result pcm_ring_buffer::read(pcm_buffer &to_buffer) {
+    audio::format const &to_format = to_buffer.format();
+
+    if (to_format.pcm_format() != this->format().pcm_format() ||
+        to_format.channel_count() != this->format().channel_count()) {
+        return pcm_buffer::copy_result(pcm_buffer::copy_error_t::invalid_format);
+    }
+
+    segments const segments = this->begin_read(to_buffer.frame_capacity());
+
+    to_buffer.set_frame_length(segments.length());
+
+    if (segments.first.length > 0) {
+        to_buffer.copy_from(this->_buffer, {.from_begin_frame = segments.first.begin_frame,
+                                            .to_begin_frame = 0,
+                                            .length = segments.first.length});
+    }
+
+    if (segments.second.length > 0) {
+        to_buffer.copy_from(this->_buffer, {.from_begin_frame = segments.second.begin_frame,
+                                            .to_begin_frame = segments.first.length,
+                                            .length = segments.second.length});
+    }
+
+    this->end_read(segments.length());
+
+    return pcm_buffer::copy_result(segments.length());
+}
+
+pcm_ring_buffer::segments pcm_ring_buffer::begin_read(uint32_t const length) {
+    uint32_t const readable_length = std::min(length, this->readable_frames());
+
+    if (readable_length < length) {
+        this->_underflow_frames.fetch_add(length - readable_length, std::memory_order_relaxed);
+    }
+
+    return this->_segments(this->_read_position.load(std::memory_order_relaxed), readable_length);
+}
+
+void pcm_ring_buffer::end_read(uint32_t const length) {
+    if (length > this->readable_frames()) {
+        throw std::out_of_range(std::string(__PRETTY_FUNCTION__) + " : out of range. length(" +
+                                std::to_string(length) + ")");
+    }
+
+    this->_read_position.fetch_add(length, std::memory_order_release);
+}
+
+uint64_t pcm_ring_buffer::overflow_frames() const {
+    return this->_overflow_frames.load(std::memory_order_relaxed);
+}
+
+uint64_t pcm_ring_buffer::underflow_frames() const {
+    return this->_underflow_frames.load(std::memory_order_relaxed);
+}
+
+void pcm_ring_buffer::reset_counters() {
+    this->_overflow_frames.store(0, std::memory_order_relaxed);
+    this->_underflow_frames.store(0, std::memory_order_relaxed);
+}
+
+pcm_ring_buffer::segments pcm_ring_buffer::_segments(uint64_t const position, uint32_t const length) const {
+    uint32_t const capacity = this->frame_capacity();
+    uint32_t const begin_frame = static_cast<uint32_t>(position % capacity);
+    uint32_t const first_length = std::min(length, capacity - begin_frame);
+
+    return segments{.first = {.begin_frame = begin_frame, .length = first_length},
+                    .second = {.begin_frame = 0, .length = length - first_length}};
+}
+
+pcm_ring_buffer_ptr pcm_ring_buffer::make_shared(audio::format const &format, uint32_t const frame_capacity) {
+    return pcm_ring_buffer_ptr(new pcm_ring_buffer{format, frame_capacity});
+}
@@ -0,0 +1,65 @@
+//
+//  yas_audio_pcm_ring_buffer.h
+//
+
+#pragma once
+
+#include <audio/yas_audio_format.h>
+#include <audio/yas_audio_pcm_buffer.h>
+#include <audio/yas_audio_ptr.h>
+
+#include <atomic>
+
+namespace yas::audio {
+struct pcm_ring_buffer final {
+    struct segment {
+        uint32_t const begin_frame = 0;
+        uint32_t const length = 0;
+    };
+
+    struct segments {
+        segment const first;
+        segment const second;
+
+        [[nodiscard]] uint32_t length() const;
+    };
+
+    [[nodiscard]] audio::format const &format() const;
+    [[nodiscard]] uint32_t frame_capacity() const;
+    [[nodiscard]] pcm_buffer &buffer();
+    [[nodiscard]] pcm_buffer const &buffer() const;
+
+    [[nodiscard]] uint32_t readable_frames() const;
+    [[nodiscard]] uint32_t writable_frames() const;
+
+    pcm_buffer::copy_result write(pcm_buffer const &);
+    [[nodiscard]] segments begin_write(uint32_t const length);
+    void end_write(uint32_t const length);
+
+    pcm_buffer::copy_result read(pcm_buffer &);
+    [[nodiscard]] segments begin_read(uint32_t const length);
+    void end_read(uint32_t const length);
+
+    [[nodiscard]] uint64_t overflow_frames() const;
+    [[nodiscard]] uint64_t underflow_frames() const;
+    void reset_counters();
+
+    [[nodiscard]] static pcm_ring_buffer_ptr make_shared(audio::format const &, uint32_t const frame_capacity);
+
+   private:
+    pcm_buffer _buffer;
+    std::atomic<uint64_t> _write_position{0};
+    std::atomic<uint64_t> _read_position{0};
+    std::atomic<uint64_t> _overflow_frames{0};
+    std::atomic<uint64_t> _underflow_frames{0};
+
+    pcm_ring_buffer(audio::format const &, uint32_t const frame_capacity);
+
+    segments _segments(uint64_t const position, uint32_t const length) const;
+
+    pcm_ring_buffer(pcm_ring_buffer const &) = delete;
+    pcm_ring_buffer(pcm_ring_buffer &&) = delete;
+    pcm_ring_buffer &operator=(pcm_ring_buffer const &) = delete;
+    pcm_ring_buffer &operator=(pcm_ring_buffer &&) = delete;
+};
+}  // namespace yas::audio
@@ -0,0 +1,72 @@
+//
+//  yas_audio_typed_pcm_view.h
+//
+
+#pragma once
+
+#include <audio/yas_audio_pcm_buffer.h>
+
+#include <type_traits>
+
+namespace yas::audio {
+static uint32_t constexpr dynamic_channel_count = 0;
+
+template <typename T, bool Interleaved, uint32_t ChannelCount = dynamic_channel_count>
+struct typed_pcm_view final {
+    using sample_type = std::remove_const_t<T>;
+    using buffer_type = std::conditional_t<std::is_const_v<T>, pcm_buffer const, pcm_buffer>;
+
+    static_assert(pcm_format_of<sample_type>() != pcm_format::other, "unsupported sample type.");
+
+    static bool constexpr is_interleaved = Interleaved;
+
+    explicit typed_pcm_view(buffer_type &);
+
+    [[nodiscard]] static bool is_available(audio::format const &);
+
+    [[nodiscard]] constexpr uint32_t channel_count() const {
+        if constexpr (ChannelCount == dynamic_channel_count) {
+            return this->_channel_count;
+        } else {
+            return ChannelCount;
+        }
+    }
+
+    [[nodiscard]] constexpr uint32_t stride() const {
+        if constexpr (Interleaved) {
+            return this->channel_count();
+        } else {
+            return 1;
+        }
+    }
+
+    [[nodiscard]] uint32_t frame_length() const {
+        return this->_frame_length;
+    }
+
+    [[nodiscard]] T *data_at_channel(uint32_t const ch_idx) const {
+        if constexpr (Interleaved) {
+            return &this->_data[ch_idx];
+        } else {
+            return static_cast<T *>(this->_abl->mBuffers[ch_idx].mData);
+        }
+    }
+
+    [[nodiscard]] T &at(uint32_t const ch_idx, uint32_t const frame) const {
+        return this->data_at_channel(ch_idx)[frame * this->stride()];
+    }
+
+   private:
+    AudioBufferList const *_abl;
+    T *_data;
+    uint32_t _channel_count;
+    uint32_t _frame_length;
+};
+
+template <typename T, uint32_t ChannelCount = dynamic_channel_count>
+using interleaved_pcm_view = typed_pcm_view<T, true, ChannelCount>;
+template <typename T, uint32_t ChannelCount = dynamic_channel_count>
+using non_interleaved_pcm_view = typed_pcm_view<T, false, ChannelCount>;
+}  // namespace yas::audio
+
+#include <audio/yas_audio_typed_pcm_view_private.h>
@@ -0,0 +1,38 @@
+//
+//  yas_audio_typed_pcm_view_private.h
+//
+
+#pragma once
+
+#include <stdexcept>
+#include <string>
+
+namespace yas::audio {
+template <typename T, bool Interleaved, uint32_t ChannelCount>
+typed_pcm_view<T, Interleaved, ChannelCount>::typed_pcm_view(buffer_type &buffer)
+    : _abl(buffer.audio_buffer_list()),
+      _data(static_cast<T *>(buffer.audio_buffer_list()->mBuffers[0].mData)),
+      _channel_count(buffer.format().channel_count()),
+      _frame_length(buffer.frame_length()) {
+    if (!is_available(buffer.format())) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : invalid format.");
+    }
+}
+
+template <typename T, bool Interleaved, uint32_t ChannelCount>
+bool typed_pcm_view<T, Interleaved, ChannelCount>::is_available(audio::format const &format) {
+    if (format.pcm_format() != pcm_format_of<sample_type>()) {
+        return false;
+    }
+
+    if (ChannelCount != dynamic_channel_count && format.channel_count() != ChannelCount) {
+        return false;
+    }
+
+    if (format.channel_count() > 1 && format.is_interleaved() != Interleaved) {
+        return false;
+    }
+
+    return true;
+}
+}  // namespace yas::audio
@@ -5,13 +5,19 @@
 #include "yas_audio_rendering_connection.h"
 
 #include "yas_audio_rendering_node.h"
+#include "yas_audio_rendering_plan.h"
 
 using namespace yas;
 using namespace yas::audio;
 
 rendering_connection::rendering_connection(uint32_t const src_bus_idx, rendering_node const *const src_node,
-                                           audio::format const format)
-    : source_bus_idx(src_bus_idx), source_node(src_node), format(std::move(format)) {
+                                           audio::format const format, rendering_slot *const src_slot,
+                                           bool const is_prerendered)
+    : source_bus_idx(src_bus_idx),
+      format(std::move(format)),
+      source_node(src_node),
+      source_slot(src_slot),
+      is_prerendered(is_prerendered) {
 }
 
 bool rendering_connection::render(pcm_buffer *const buffer, time const &time) const {
@@ -25,10 +31,28 @@ bool rendering_connection::render(pcm_buffer *const buffer, time const &time) co
 
     assert(this->source_node->render_handler);
 
-    this->source_node->render_handler({.buffer = buffer,
-                                       .bus_idx = this->source_bus_idx,
-                                       .time = time,
-                                       .source_connections = this->source_node->source_connections});
+    if (auto *const slot = this->source_slot) {
+        uint32_t const frame_length = buffer->frame_length();
+        pcm_buffer &slot_buffer = slot->buffer();
+
+        if (slot->is_rendered(frame_length, time)) {
+            return buffer->copy_from(slot_buffer).is_success();
+        }
+
+        // a pulled source shared by several connections is rendered once per frame length and time
+        if (!this->is_prerendered && frame_length <= slot_buffer.frame_capacity()) {
+            slot_buffer.set_frame_length(frame_length);
+            slot_buffer.clear();
+
+            this->source_node->render(&slot_buffer, this->source_bus_idx, time);
+
+            slot->set_rendered(time);
+
+            return buffer->copy_from(slot_buffer).is_success();
+        }
+    }
+
+    this->source_node->render(buffer, this->source_bus_idx, time);
 
     return true;
 }
@@ -10,14 +10,22 @@
 
 namespace yas::audio {
 class rendering_node;
+class rendering_slot;
 
 struct rendering_connection {
     uint32_t const source_bus_idx;
     audio::format const format;
     rendering_node const *const source_node;
+    rendering_slot *const source_slot;
+    // false when the source is rendered into its slot by the pulls of its consumer instead of a plan step
+    bool const is_prerendered;
 
-    rendering_connection(uint32_t const src_bus_idx, rendering_node const *const src_node, audio::format const format);
+    rendering_connection(uint32_t const src_bus_idx, rendering_node const *const src_node, audio::format const format,
+                         rendering_slot *const src_slot = nullptr, bool const is_prerendered = true);
 
+    // a source with a slot is rendered once per frame length and time within a cycle.
+    // pulling it again with the same frame length and time copies the rendered slot instead of rendering again,
+    // and a prerendered source pulled with another frame length or time is rendered into the buffer directly
     bool render(audio::pcm_buffer *const, audio::time const &) const;
 };
 }  // namespace yas::audio
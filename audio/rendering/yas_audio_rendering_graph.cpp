@@ -7,49 +7,189 @@
 #include <audio/yas_audio_graph_connection.h>
 #include <audio/yas_audio_graph_node.h>
 #include <cpp_utils/yas_stl_utils.h>
+#include <mach/mach_time.h>
+
+#include <algorithm>
+#include <tuple>
+#include <unordered_map>
 
 using namespace yas;
 using namespace yas::audio;
 
 namespace yas::audio {
+struct rendering_graph_cache {
+    struct node_entry {
+        std::weak_ptr<renderable_graph_node> graph_node;
+        std::shared_ptr<rendering_node> node;
+    };
 
-std::vector<std::unique_ptr<rendering_node>> make_rendering_nodes(renderable_graph_node_ptr const &node) {
-    node->prepare_rendering();
+    using slot_key = std::pair<renderable_graph_node const *, uint32_t>;
 
-    assert(node->render_handler());
+    pcm_buffer_pool_ptr buffer_pool = nullptr;
+    uint32_t maximum_frames = 0;
+    std::unordered_map<renderable_graph_node const *, node_entry> nodes;
+    std::map<slot_key, std::shared_ptr<rendering_slot>> slots;
+};
 
-    std::vector<std::unique_ptr<rendering_node>> sub_nodes;
-    rendering_connection_map connections;
+struct rendering_graph_context {
+    struct slot_source {
+        renderable_graph_node const *node;
+        uint32_t bus_idx;
+        audio::format format;
+        bool is_prerendered;
+        std::size_t connection_count;
+    };
+
+    rendering_graph_cache const *previous = nullptr;
+    renderable_graph_node_raw_set const *dirty_nodes = nullptr;
+
+    std::vector<renderable_graph_node_ptr> sorted_nodes;
+    std::unordered_map<renderable_graph_node const *, std::size_t> node_indices;
+    std::vector<slot_source> slot_sources;
+    std::map<rendering_graph_cache::slot_key, std::size_t> slot_indices;
+
+    std::vector<std::shared_ptr<rendering_slot>> slots;
+    std::unordered_map<renderable_graph_node const *, rendering_node const *> built_nodes;
+    std::size_t rebuilt_node_count = 0;
+
+    rendering_graph_cache::node_entry const *previous_node(renderable_graph_node_ptr const &node) const {
+        if (!this->previous) {
+            return nullptr;
+        }
+
+        auto const iterator = this->previous->nodes.find(node.get());
+        if (iterator == this->previous->nodes.end() || iterator->second.graph_node.lock() != node) {
+            // the address may belong to a node that was released since the previous build
+            return nullptr;
+        }
+
+        return &iterator->second;
+    }
+
+    std::shared_ptr<rendering_slot> previous_slot(slot_source const &source, uint32_t const maximum_frames) const {
+        if (!this->previous || this->previous->maximum_frames != maximum_frames) {
+            return nullptr;
+        }
+
+        auto const iterator = this->previous->slots.find({source.node, source.bus_idx});
+        if (iterator == this->previous->slots.end() || iterator->second->buffer().format() != source.format) {
+            return nullptr;
+        }
+
+        return iterator->second;
+    }
+
+    bool is_dirty(renderable_graph_node_ptr const &node) const {
+        return this->dirty_nodes && this->dirty_nodes->count(node.get()) > 0;
+    }
+
+    rendering_connection make_connection(renderable_graph_connection_ptr const &connection) const {
+        renderable_graph_node const *const src_node = connection->source_node().get();
+        std::size_t const slot_idx = this->slot_indices.at({src_node, connection->source_bus()});
+
+        return rendering_connection{connection->source_bus(), this->built_nodes.at(src_node), connection->format(),
+                                    this->slots.at(slot_idx).get(), this->slot_sources.at(slot_idx).is_prerendered};
+    }
+};
+
+static bool is_equal_connection(rendering_connection const &lhs, rendering_connection const &rhs) {
+    return lhs.source_bus_idx == rhs.source_bus_idx && lhs.source_node == rhs.source_node &&
+           lhs.source_slot == rhs.source_slot && lhs.is_prerendered == rhs.is_prerendered && lhs.format == rhs.format;
+}
+
+static bool is_reusable(rendering_node const &previous_node, renderable_graph_node_ptr const &node,
+                        rendering_graph_context const &context) {
+    std::size_t count = 0;
+
+    for (auto const &pair : node->input_connections()) {
+        if (pair.second.expired()) {
+            continue;
+        }
+
+        auto const iterator = previous_node.source_connections.find(pair.first);
+        if (iterator == previous_node.source_connections.end() ||
+            !is_equal_connection(iterator->second, context.make_connection(pair.second.lock()))) {
+            return false;
+        }
+
+        ++count;
+    }
+
+    return count == previous_node.source_connections.size();
+}
+
+void collect_rendering_nodes(renderable_graph_node_ptr const &node, rendering_graph_context &context) {
+    if (context.node_indices.count(node.get()) > 0) {
+        return;
+    }
+
+    context.node_indices.emplace(node.get(), context.node_indices.size());
 
     for (auto const &pair : node->input_connections()) {
         if (pair.second.expired()) {
             continue;
         }
 
-        uint32_t const dst_bus_idx = pair.first;
         renderable_graph_connection_ptr const connection = pair.second.lock();
         renderable_graph_node_ptr const src_node = connection->source_node();
 
-        std::vector<std::unique_ptr<rendering_node>> src_rendering_nodes = make_rendering_nodes(src_node);
+        collect_rendering_nodes(src_node, context);
+
+        rendering_graph_cache::slot_key const key{src_node.get(), connection->source_bus()};
+        if (auto const iterator = context.slot_indices.find(key); iterator != context.slot_indices.end()) {
+            ++context.slot_sources.at(iterator->second).connection_count;
+        } else {
+            context.slot_indices.emplace(key, context.slot_sources.size());
+            context.slot_sources.emplace_back(rendering_graph_context::slot_source{.node = src_node.get(),
+                                                                                   .bus_idx = connection->source_bus(),
+                                                                                   .format = connection->format(),
+                                                                                   .is_prerendered = true,
+                                                                                   .connection_count = 1});
+        }
+    }
+
+    context.sorted_nodes.emplace_back(node);
+}
 
-        connections.emplace(dst_bus_idx, rendering_connection{connection->source_bus(), src_rendering_nodes.at(0).get(),
-                                                              connection->format()});
+std::shared_ptr<rendering_node> make_rendering_node(renderable_graph_node_ptr const &node,
+                                                    rendering_graph_context &context) {
+    auto const *const previous = context.previous_node(node);
+    bool const is_dirty = context.is_dirty(node);
 
-        yas::move_back_insert(sub_nodes, std::move(src_rendering_nodes));
+    // a clean node is reused as long as its sources and slots are the same objects as before
+    if (previous && !is_dirty && is_reusable(*previous->node, node, context)) {
+        return previous->node;
     }
 
-    std::vector<std::unique_ptr<rendering_node>> result;
+    // a clean node downstream of a rebuilt one only needs new connections, so it is not prepared again
+    if (!previous || is_dirty) {
+        node->prepare_rendering();
+    }
 
-    result.emplace_back(std::make_unique<rendering_node>(node->render_handler(), std::move(connections)));
+    assert(node->render_handler());
 
-    if (!sub_nodes.empty()) {
-        yas::move_back_insert(result, std::move(sub_nodes));
+    rendering_connection_map connections;
+
+    for (auto const &pair : node->input_connections()) {
+        if (pair.second.expired()) {
+            continue;
+        }
+
+        connections.emplace(pair.first, context.make_connection(pair.second.lock()));
     }
 
-    return result;
+    ++context.rebuilt_node_count;
+
+    return std::make_shared<rendering_node>(node->render_handler(), std::move(connections));
 }
 
-std::unique_ptr<rendering_output_node> make_rendering_output_node(renderable_graph_node_ptr const &output_node) {
+std::unique_ptr<rendering_output_node> make_rendering_output_node(renderable_graph_node_ptr const &output_node,
+                                                                  uint32_t const maximum_frames,
+                                                                  rendering_worker_pool_ptr const &worker_pool,
+                                                                  rendering_graph_context &context,
+                                                                  rendering_graph_cache &cache) {
+    cache.maximum_frames = maximum_frames;
+
     if (output_node->input_connections().empty()) {
         return nullptr;
     }
@@ -60,17 +200,175 @@ std::unique_ptr<rendering_output_node> make_rendering_output_node(renderable_gra
         return nullptr;
     }
 
-    renderable_graph_connection_ptr const connection = pair.second.lock();
-    renderable_graph_node_ptr const src_node = connection->source_node();
+    renderable_graph_connection_ptr const output_connection = pair.second.lock();
+    renderable_graph_node_ptr const root_node = output_connection->source_node();
 
-    auto nodes = make_rendering_nodes(src_node);
+    collect_rendering_nodes(root_node, context);
 
-    if (nodes.empty()) {
-        return nullptr;
+    // only the sources of a node that opts in to prerendering, and is itself rendered in lockstep with the output,
+    // get a step. the other nodes are rendered only when they are pulled, as their consumers may skip them
+    std::unordered_set<renderable_graph_node const *> pulled_nodes;
+
+    for (auto iterator = context.sorted_nodes.rbegin(); iterator != context.sorted_nodes.rend(); ++iterator) {
+        auto const &node = *iterator;
+
+        if (node->is_input_prerenderable() && pulled_nodes.count(node.get()) == 0) {
+            continue;
+        }
+
+        for (auto const &pair : node->input_connections()) {
+            if (auto const connection = pair.second.lock()) {
+                pulled_nodes.insert(connection->source_node().get());
+            }
+        }
+    }
+
+    for (auto &source : context.slot_sources) {
+        source.is_prerendered = pulled_nodes.count(source.node) == 0;
+    }
+
+    auto &slots = context.slots;
+    slots.reserve(context.slot_sources.size());
+
+    for (auto const &source : context.slot_sources) {
+        std::shared_ptr<rendering_slot> slot = nullptr;
+
+        // without maximum frames every source is pulled recursively, so there is no slot to render into.
+        // a pulled source with a single connection renders straight into the buffer of its consumer
+        if (maximum_frames > 0 && (source.is_prerendered || source.connection_count > 1)) {
+            slot = context.previous_slot(source, maximum_frames);
+            if (!slot) {
+                slot = std::make_shared<rendering_slot>(cache.buffer_pool, source.format, maximum_frames);
+            }
+            cache.slots.emplace(rendering_graph_cache::slot_key{source.node, source.bus_idx}, slot);
+        }
+
+        slots.emplace_back(std::move(slot));
+    }
+
+    // sources are sorted before their destinations, so every connection refers to an already built node
+    std::vector<std::shared_ptr<rendering_node>> nodes(context.sorted_nodes.size());
+    auto &built_nodes = context.built_nodes;
+    built_nodes.reserve(context.sorted_nodes.size());
+    cache.nodes.reserve(context.sorted_nodes.size());
+
+    for (auto const &node : context.sorted_nodes) {
+        auto &built_node = nodes.at(context.node_indices.at(node.get()));
+        built_node = make_rendering_node(node, context);
+        built_nodes.emplace(node.get(), built_node.get());
+        cache.nodes.emplace(node.get(), rendering_graph_cache::node_entry{.graph_node = node, .node = built_node});
     }
 
+    // a node is one level above the deepest of its sources, so nodes in the same level are independent
+    std::unordered_map<renderable_graph_node const *, uint32_t> levels;
+    std::unordered_map<renderable_graph_node const *, std::size_t> sorted_indices;
+
+    for (auto const &node : context.sorted_nodes) {
+        uint32_t level = 0;
+
+        for (auto const &pair : node->input_connections()) {
+            if (auto const connection = pair.second.lock()) {
+                level = std::max(level, levels.at(connection->source_node().get()) + 1);
+            }
+        }
+
+        levels.emplace(node.get(), level);
+        sorted_indices.emplace(node.get(), sorted_indices.size());
+    }
+
+    // a pulled node has no step, so the nodes of a level that can pull the same node are put in one task group
+    std::unordered_map<renderable_graph_node const *, renderable_graph_node const *> group_parents;
+    std::map<std::pair<uint32_t, renderable_graph_node const *>, renderable_graph_node const *> pulled_owners;
+
+    auto const find_group_root = [&group_parents](renderable_graph_node const *node) {
+        while (group_parents.at(node) != node) {
+            group_parents.at(node) = group_parents.at(group_parents.at(node));
+            node = group_parents.at(node);
+        }
+        return node;
+    };
+
+    for (auto const &source : context.slot_sources) {
+        if (!source.is_prerendered || !group_parents.emplace(source.node, source.node).second) {
+            continue;
+        }
+
+        uint32_t const level = levels.at(source.node);
+        std::vector<renderable_graph_node const *> stack{source.node};
+        std::unordered_set<renderable_graph_node const *> visited;
+
+        while (!stack.empty()) {
+            auto const *const node = stack.back();
+            stack.pop_back();
+
+            for (auto const &pair : node->input_connections()) {
+                if (auto const connection = pair.second.lock()) {
+                    auto const *const src_node = connection->source_node().get();
+
+                    if (pulled_nodes.count(src_node) == 0 || !visited.insert(src_node).second) {
+                        continue;
+                    }
+
+                    stack.emplace_back(src_node);
+
+                    auto const [iterator, is_inserted] = pulled_owners.emplace(std::make_pair(level, src_node),
+                                                                               source.node);
+                    if (!is_inserted) {
+                        auto const *const lhs_root = find_group_root(iterator->second);
+                        auto const *const rhs_root = find_group_root(source.node);
+                        if (lhs_root != rhs_root) {
+                            group_parents.at(rhs_root) = lhs_root;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    std::unordered_map<renderable_graph_node const *, std::size_t> task_groups;
+    task_groups.reserve(group_parents.size());
+
+    for (auto const &pair : group_parents) {
+        task_groups.emplace(pair.first, sorted_indices.at(find_group_root(pair.first)));
+    }
+
+    // steps of the same task group are kept together so that a node is rendered on one thread at a time
+    std::vector<std::size_t> slot_order;
+    slot_order.reserve(context.slot_sources.size());
+
+    for (std::size_t slot_idx = 0; slot_idx < context.slot_sources.size(); ++slot_idx) {
+        if (context.slot_sources.at(slot_idx).is_prerendered && slots.at(slot_idx)) {
+            slot_order.emplace_back(slot_idx);
+        }
+    }
+
+    std::stable_sort(slot_order.begin(), slot_order.end(), [&](std::size_t const lhs, std::size_t const rhs) {
+        auto const *const lhs_node = context.slot_sources.at(lhs).node;
+        auto const *const rhs_node = context.slot_sources.at(rhs).node;
+        return std::make_tuple(levels.at(lhs_node), task_groups.at(lhs_node), sorted_indices.at(lhs_node)) <
+               std::make_tuple(levels.at(rhs_node), task_groups.at(rhs_node), sorted_indices.at(rhs_node));
+    });
+
+    std::vector<rendering_step> steps;
+    steps.reserve(slot_order.size());
+
+    for (std::size_t const slot_idx : slot_order) {
+        auto const &source = context.slot_sources.at(slot_idx);
+        steps.emplace_back(rendering_step{.node = built_nodes.at(source.node),
+                                          .bus_idx = source.bus_idx,
+                                          .slot = slots.at(slot_idx).get(),
+                                          .level = levels.at(source.node),
+                                          .task_group = task_groups.at(source.node)});
+    }
+
+    erase_if(slots, [](auto const &slot) { return !slot; });
+
+    rendering_node const *const root = nodes.at(0).get();
+    auto plan = std::make_unique<rendering_plan>(std::move(steps), std::move(slots), maximum_frames, worker_pool);
+
     return std::make_unique<rendering_output_node>(
-        std::move(nodes), rendering_connection{connection->source_bus(), nodes.at(0).get(), connection->format()});
+        std::move(nodes), std::move(plan),
+        rendering_connection{output_connection->source_bus(), root, output_connection->format()});
 }
 
 std::unique_ptr<rendering_input_node> make_rendering_input_node(renderable_graph_node_ptr const &input_node) {
@@ -97,10 +395,44 @@ std::unique_ptr<rendering_input_node> make_rendering_input_node(renderable_graph
 }  // namespace yas::audio
 
 rendering_graph::rendering_graph(renderable_graph_node_ptr const &output_node,
-                                 renderable_graph_node_ptr const &input_node)
-    : _output_node(make_rendering_output_node(output_node)), _input_node(make_rendering_input_node(input_node)) {
+                                 renderable_graph_node_ptr const &input_node, uint32_t const maximum_frames,
+                                 rendering_worker_pool_ptr const &worker_pool, pcm_buffer_pool_ptr const &buffer_pool)
+    : rendering_graph(output_node, input_node, maximum_frames, worker_pool,
+                      buffer_pool ? buffer_pool : pcm_buffer_pool::make_shared(), nullptr, nullptr) {
 }
 
+rendering_graph::rendering_graph(renderable_graph_node_ptr const &output_node,
+                                 renderable_graph_node_ptr const &input_node, uint32_t const maximum_frames,
+                                 rendering_worker_pool_ptr const &worker_pool, rendering_graph const &previous,
+                                 renderable_graph_node_raw_set const &dirty_nodes)
+    : rendering_graph(output_node, input_node, maximum_frames, worker_pool, previous.buffer_pool(),
+                      previous._cache.get(), &dirty_nodes) {
+}
+
+rendering_graph::rendering_graph(renderable_graph_node_ptr const &output_node,
+                                 renderable_graph_node_ptr const &input_node, uint32_t const maximum_frames,
+                                 rendering_worker_pool_ptr const &worker_pool, pcm_buffer_pool_ptr const &buffer_pool,
+                                 rendering_graph_cache const *previous, renderable_graph_node_raw_set const *dirty_nodes)
+    : _cache(std::make_unique<rendering_graph_cache>()) {
+    uint64_t const begin_host_time = mach_absolute_time();
+
+    this->_cache->buffer_pool = buffer_pool;
+
+    rendering_graph_context context;
+    context.previous = previous;
+    context.dirty_nodes = dirty_nodes;
+
+    this->_output_node = make_rendering_output_node(output_node, maximum_frames, worker_pool, context, *this->_cache);
+    this->_input_node = make_rendering_input_node(input_node);
+
+    this->_build_info = rendering_build_info{
+        .node_count = context.sorted_nodes.size(),
+        .rebuilt_node_count = context.rebuilt_node_count,
+        .duration = seconds_for_host_time(mach_absolute_time() - begin_host_time)};
+}
+
+rendering_graph::~rendering_graph() = default;
+
 rendering_output_node const *rendering_graph::output_node() const {
     return this->_output_node ? this->_output_node.get() : nullptr;
 }
@@ -108,3 +440,11 @@ rendering_output_node const *rendering_graph::output_node() const {
 rendering_input_node const *rendering_graph::input_node() const {
     return this->_input_node ? this->_input_node.get() : nullptr;
 }
+
+rendering_build_info const &rendering_graph::build_info() const {
+    return this->_build_info;
+}
+
+pcm_buffer_pool_ptr const &rendering_graph::buffer_pool() const {
+    return this->_cache->buffer_pool;
+}
@@ -8,21 +8,52 @@
 #include <audio/yas_audio_rendering_node.h>
 
 #include <memory>
+#include <unordered_set>
 
 namespace yas::audio {
+struct rendering_graph_cache;
+
+using renderable_graph_node_raw_set = std::unordered_set<renderable_graph_node const *>;
+
+struct rendering_build_info {
+    std::size_t node_count;
+    std::size_t rebuilt_node_count;
+    double duration;
+};
+
 struct rendering_graph {
-    rendering_graph(renderable_graph_node_ptr const &output_node, renderable_graph_node_ptr const &input_node);
+    // the slot buffers are reserved in the buffer pool, or in a pool of the graph's own when it is null
+    rendering_graph(renderable_graph_node_ptr const &output_node, renderable_graph_node_ptr const &input_node,
+                    uint32_t const maximum_frames, rendering_worker_pool_ptr const &worker_pool = nullptr,
+                    pcm_buffer_pool_ptr const &buffer_pool = nullptr);
+    // reuses the rendering nodes of the previous graph that are neither dirty nor downstream of a dirty node
+    // and the buffer pool of the previous graph
+    rendering_graph(renderable_graph_node_ptr const &output_node, renderable_graph_node_ptr const &input_node,
+                    uint32_t const maximum_frames, rendering_worker_pool_ptr const &worker_pool,
+                    rendering_graph const &previous, renderable_graph_node_raw_set const &dirty_nodes);
+
+    ~rendering_graph();
 
     [[nodiscard]] rendering_output_node const *output_node() const;
     [[nodiscard]] rendering_input_node const *input_node() const;
 
+    [[nodiscard]] rendering_build_info const &build_info() const;
+    [[nodiscard]] pcm_buffer_pool_ptr const &buffer_pool() const;
+
    private:
     rendering_graph(rendering_graph const &) = delete;
     rendering_graph(rendering_graph &&) = delete;
     rendering_graph &operator=(rendering_graph const &) = delete;
     rendering_graph &operator=(rendering_graph &&) = delete;
 
+    rendering_graph(renderable_graph_node_ptr const &output_node, renderable_graph_node_ptr const &input_node,
+                    uint32_t const maximum_frames, rendering_worker_pool_ptr const &worker_pool,
+                    pcm_buffer_pool_ptr const &buffer_pool, rendering_graph_cache const *previous,
+                    renderable_graph_node_raw_set const *dirty_nodes);
+
+    std::unique_ptr<rendering_graph_cache> _cache;
     std::unique_ptr<rendering_output_node> _output_node;
     std::unique_ptr<rendering_input_node> _input_node;
+    rendering_build_info _build_info{.node_count = 0, .rebuilt_node_count = 0, .duration = 0.0};
 };
 }  // namespace yas::audio
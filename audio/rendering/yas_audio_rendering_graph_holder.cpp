@@ -0,0 +1,115 @@
+//
+//  yas_audio_rendering_graph_holder.cpp
+//
+
+#include "yas_audio_rendering_graph_holder.h"
+
+#include <cpp_utils/yas_stl_utils.h>
+#include <dispatch/dispatch.h>
+
+#include <stdexcept>
+#include <string>
+
+#include "yas_audio_rendering_graph.h"
+
+using namespace yas;
+using namespace yas::audio;
+
+#pragma mark - reading
+
+rendering_graph_holder::reading::reading(rendering_graph_holder &holder)
+    : _holder(holder), _graph(holder._begin_reading()) {
+}
+
+rendering_graph_holder::reading::~reading() {
+    this->_holder._end_reading();
+}
+
+rendering_graph const *rendering_graph_holder::reading::graph() const {
+    return this->_graph;
+}
+
+#pragma mark - rendering_graph_holder
+
+rendering_graph_holder::rendering_graph_holder(double const grace_period) : _grace_period(grace_period) {
+    if (grace_period < 0.0) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : grace_period must not be negative.");
+    }
+}
+
+double rendering_graph_holder::grace_period() const {
+    return this->_grace_period;
+}
+
+void rendering_graph_holder::set_graph(std::shared_ptr<rendering_graph> const &graph) {
+    if (graph == this->_graph) {
+        return;
+    }
+
+    this->_current.store(graph.get());
+
+    // readers that load the epoch after this increment are guaranteed to see the new graph
+    uint64_t const epoch = this->_epoch.fetch_add(1) + 1;
+
+    if (this->_graph) {
+        this->_retired_graphs.emplace_back(retired_graph{.graph = std::move(this->_graph), .epoch = epoch});
+    }
+
+    this->_graph = graph;
+
+    this->reclaim();
+}
+
+std::shared_ptr<rendering_graph> const &rendering_graph_holder::graph() const {
+    return this->_graph;
+}
+
+std::size_t rendering_graph_holder::retired_count() const {
+    return this->_retired_graphs.size();
+}
+
+void rendering_graph_holder::reclaim() {
+    uint64_t const reading_epoch = this->_reading_epoch.load();
+
+    erase_if(this->_retired_graphs, [&reading_epoch](retired_graph const &retired) {
+        return reading_epoch == _idle_epoch || reading_epoch >= retired.epoch;
+    });
+
+    if (!this->_retired_graphs.empty()) {
+        this->_schedule_reclaim();
+    }
+}
+
+rendering_graph const *rendering_graph_holder::_begin_reading() {
+    this->_reading_epoch.store(this->_epoch.load());
+    return this->_current.load();
+}
+
+void rendering_graph_holder::_end_reading() {
+    this->_reading_epoch.store(_idle_epoch, std::memory_order_release);
+}
+
+void rendering_graph_holder::_schedule_reclaim() {
+    if (this->_is_reclaim_scheduled) {
+        return;
+    }
+
+    this->_is_reclaim_scheduled = true;
+
+    auto const delay = static_cast<int64_t>(this->_grace_period * NSEC_PER_SEC);
+    auto const weak_holder = this->_weak_holder;
+
+    // retired graphs are released on the main queue so that the render thread never frees memory
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, delay), dispatch_get_main_queue(), ^{
+        if (auto const holder = weak_holder.lock()) {
+            holder->_is_reclaim_scheduled = false;
+            holder->reclaim();
+        }
+    });
+}
+
+rendering_graph_holder_ptr rendering_graph_holder::make_shared(double const grace_period) {
+    auto shared = rendering_graph_holder_ptr(new rendering_graph_holder{grace_period});
+    shared->_weak_holder = shared;
+    return shared;
+}
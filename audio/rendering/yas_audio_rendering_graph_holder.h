@@ -0,0 +1,74 @@
+//
+//  yas_audio_rendering_graph_holder.h
+//
+
+#pragma once
+
+#include <audio/yas_audio_ptr.h>
+
+#include <atomic>
+#include <vector>
+
+namespace yas::audio {
+struct rendering_graph;
+
+// set_graph and reclaim are called on the main thread.
+// only one thread, the render thread, may read at a time because a single reading epoch is tracked.
+struct rendering_graph_holder final {
+    struct reading final {
+        explicit reading(rendering_graph_holder &);
+        ~reading();
+
+        [[nodiscard]] rendering_graph const *graph() const;
+
+       private:
+        rendering_graph_holder &_holder;
+        rendering_graph const *_graph;
+
+        reading(reading const &) = delete;
+        reading(reading &&) = delete;
+        reading &operator=(reading const &) = delete;
+        reading &operator=(reading &&) = delete;
+    };
+
+    [[nodiscard]] double grace_period() const;
+
+    void set_graph(std::shared_ptr<rendering_graph> const &);
+    [[nodiscard]] std::shared_ptr<rendering_graph> const &graph() const;
+
+    [[nodiscard]] std::size_t retired_count() const;
+    void reclaim();
+
+    [[nodiscard]] static rendering_graph_holder_ptr make_shared(double const grace_period = 0.1);
+
+   private:
+    struct retired_graph {
+        std::shared_ptr<rendering_graph> graph;
+        uint64_t epoch;
+    };
+
+    static uint64_t constexpr _idle_epoch = 0;
+
+    double const _grace_period;
+    std::weak_ptr<rendering_graph_holder> _weak_holder;
+
+    std::atomic<rendering_graph const *> _current = nullptr;
+    std::atomic<uint64_t> _epoch = 1;
+    std::atomic<uint64_t> _reading_epoch = _idle_epoch;
+
+    std::shared_ptr<rendering_graph> _graph = nullptr;
+    std::vector<retired_graph> _retired_graphs;
+    bool _is_reclaim_scheduled = false;
+
+    explicit rendering_graph_holder(double const grace_period);
+
+    rendering_graph_holder(rendering_graph_holder const &) = delete;
+    rendering_graph_holder(rendering_graph_holder &&) = delete;
+    rendering_graph_holder &operator=(rendering_graph_holder const &) = delete;
+    rendering_graph_holder &operator=(rendering_graph_holder &&) = delete;
+
+    rendering_graph const *_begin_reading();
+    void _end_reading();
+    void _schedule_reclaim();
+};
+}  // namespace yas::audio
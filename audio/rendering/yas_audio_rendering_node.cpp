@@ -13,6 +13,11 @@ rendering_node::rendering_node(node_render_f const &handler, rendering_connectio
     : render_handler(handler), source_connections(std::move(connections)) {
 }
 
+void rendering_node::render(pcm_buffer *const buffer, uint32_t const bus_idx, time const &time) const {
+    this->render_handler(
+        {.buffer = buffer, .bus_idx = bus_idx, .time = time, .source_connections = this->source_connections});
+}
+
 bool rendering_node::output_render(pcm_buffer *const buffer, time const &time) const {
     if (!buffer || this->source_connections.empty()) {
         return false;
@@ -43,13 +48,17 @@ bool rendering_node::input_render(pcm_buffer *const buffer, time const &time) co
 
 #pragma mark - rendering_output_node
 
-rendering_output_node::rendering_output_node(std::vector<std::unique_ptr<rendering_node>> &&nodes,
-                                             rendering_connection &&connection)
-    : source_nodes(std::move(nodes)), source_connection(std::move(connection)) {
+rendering_output_node::rendering_output_node(std::vector<std::shared_ptr<rendering_node>> &&nodes,
+                                             std::unique_ptr<rendering_plan> &&plan, rendering_connection &&connection)
+    : source_nodes(std::move(nodes)), plan(std::move(plan)), source_connection(std::move(connection)) {
 }
 
 bool rendering_output_node::render(pcm_buffer *const buffer, time const &time) const {
-    return this->source_connection.render(buffer, time);
+    if (!buffer) {
+        return false;
+    }
+
+    return this->plan->render(this->source_connection, buffer, time);
 }
 
 #pragma mark - rendering_input_node
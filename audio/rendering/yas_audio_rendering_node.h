@@ -5,8 +5,11 @@
 #pragma once
 
 #include <audio/yas_audio_rendering_connection.h>
+#include <audio/yas_audio_rendering_plan.h>
 #include <audio/yas_audio_rendering_types.h>
 
+#include <memory>
+
 namespace yas::audio {
 struct rendering_node {
     rendering_node(node_render_f const &, rendering_connection_map &&);
@@ -14,6 +17,7 @@ struct rendering_node {
     node_render_f const render_handler;
     rendering_connection_map const source_connections;
 
+    void render(pcm_buffer *const, uint32_t const bus_idx, audio::time const &) const;
     bool output_render(pcm_buffer *const, audio::time const &) const;
     bool input_render(pcm_buffer *const, audio::time const &) const;
 
@@ -25,9 +29,12 @@ struct rendering_node {
 };
 
 struct rendering_output_node {
-    explicit rendering_output_node(std::vector<std::unique_ptr<rendering_node>> &&, rendering_connection &&);
+    rendering_output_node(std::vector<std::shared_ptr<rendering_node>> &&, std::unique_ptr<rendering_plan> &&,
+                          rendering_connection &&);
 
-    std::vector<std::unique_ptr<rendering_node>> const source_nodes;
+    // rendering nodes are shared with the graphs rebuilt from this one while they are unchanged
+    std::vector<std::shared_ptr<rendering_node>> const source_nodes;
+    std::unique_ptr<rendering_plan> const plan;
     rendering_connection const source_connection;
 
     bool render(pcm_buffer *const, audio::time const &) const;
@@ -0,0 +1,150 @@
+//
+//  yas_audio_rendering_plan.cpp
+//
+
+#include "yas_audio_rendering_plan.h"
+
+#include <stdexcept>
+#include <string>
+
+#include "yas_audio_rendering_connection.h"
+#include "yas_audio_rendering_node.h"
+#include "yas_audio_rendering_worker_pool.h"
+
+using namespace yas;
+using namespace yas::audio;
+
+rendering_slot::rendering_slot(pcm_buffer_pool_ptr const &buffer_pool, audio::format const &format,
+                               uint32_t const frame_capacity)
+    : _buffer_pool(buffer_pool),
+      _buffer_key(buffer_pool->reserve(format, frame_capacity)),
+      _buffer(buffer_pool->acquire(this->_buffer_key)) {
+    if (!this->_buffer) {
+        buffer_pool->unreserve(this->_buffer_key);
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " : the reserved buffer is in use.");
+    }
+}
+
+rendering_slot::~rendering_slot() {
+    this->_buffer_pool->release(this->_buffer_key, this->_buffer);
+    this->_buffer_pool->unreserve(this->_buffer_key);
+}
+
+pcm_buffer &rendering_slot::buffer() const {
+    return *this->_buffer;
+}
+
+bool rendering_slot::is_rendered(uint32_t const frame_length, audio::time const &time) const {
+    return this->_rendered_time.has_value() && this->_buffer->frame_length() == frame_length &&
+           this->_rendered_time.value() == time;
+}
+
+void rendering_slot::set_rendered(audio::time const &time) {
+    this->_rendered_time = time;
+}
+
+void rendering_slot::reset_rendered() {
+    this->_rendered_time = std::nullopt;
+}
+
+namespace yas::audio::rendering_plan_utils {
+static std::vector<rendering_task> make_tasks(std::vector<rendering_step> const &steps) {
+    std::vector<rendering_task> tasks;
+
+    for (std::size_t idx = 0; idx < steps.size(); ++idx) {
+        auto const &step = steps.at(idx);
+
+        if (tasks.empty() || step.task_group != steps.at(idx - 1).task_group ||
+            step.level != steps.at(idx - 1).level) {
+            tasks.emplace_back(rendering_task{.step_begin = idx, .step_end = idx + 1});
+        } else {
+            tasks.back().step_end = idx + 1;
+        }
+    }
+
+    return tasks;
+}
+
+static std::vector<std::size_t> make_level_offsets(std::vector<rendering_step> const &steps,
+                                                   std::vector<rendering_task> const &tasks) {
+    std::vector<std::size_t> offsets;
+
+    for (std::size_t idx = 0; idx < tasks.size(); ++idx) {
+        uint32_t const level = steps.at(tasks.at(idx).step_begin).level;
+
+        if (offsets.empty() || level != steps.at(tasks.at(idx - 1).step_begin).level) {
+            offsets.emplace_back(idx);
+        }
+    }
+
+    offsets.emplace_back(tasks.size());
+
+    return offsets;
+}
+}  // namespace yas::audio::rendering_plan_utils
+
+rendering_plan::rendering_plan(std::vector<rendering_step> &&steps,
+                               std::vector<std::shared_ptr<rendering_slot>> &&slots, uint32_t const maximum_frames,
+                               rendering_worker_pool_ptr const &worker_pool)
+    : steps(std::move(steps)),
+      tasks(rendering_plan_utils::make_tasks(this->steps)),
+      level_offsets(rendering_plan_utils::make_level_offsets(this->steps, this->tasks)),
+      maximum_frames(maximum_frames),
+      worker_pool(worker_pool),
+      _slots(std::move(slots)) {
+}
+
+bool rendering_plan::render(rendering_connection const &output_connection, pcm_buffer *const buffer,
+                            time const &time) const {
+    uint32_t const frame_length = buffer->frame_length();
+
+    // a buffer larger than the slots falls back to pulling the sources recursively
+    if (frame_length <= this->maximum_frames) {
+        if (this->worker_pool && this->worker_pool->worker_count() > 0) {
+            struct context {
+                std::size_t task_offset;
+                uint32_t const frame_length;
+                audio::time const &time;
+            } context{.task_offset = 0, .frame_length = frame_length, .time = time};
+
+            rendering_worker_pool::task_f const task = [this, &context](std::size_t const task_idx) {
+                this->_render_task(context.task_offset + task_idx, context.frame_length, context.time);
+            };
+
+            // the tasks in a level only depend on the previous levels
+            for (std::size_t level = 0; level + 1 < this->level_offsets.size(); ++level) {
+                context.task_offset = this->level_offsets.at(level);
+                this->worker_pool->run(this->level_offsets.at(level + 1) - context.task_offset, task);
+            }
+        } else {
+            for (std::size_t task_idx = 0; task_idx < this->tasks.size(); ++task_idx) {
+                this->_render_task(task_idx, frame_length, time);
+            }
+        }
+    }
+
+    bool const result = output_connection.render(buffer, time);
+
+    for (auto const &slot : this->_slots) {
+        slot->reset_rendered();
+    }
+
+    return result;
+}
+
+void rendering_plan::_render_task(std::size_t const task_idx, uint32_t const frame_length,
+                                  audio::time const &time) const {
+    auto const &task = this->tasks[task_idx];
+
+    for (std::size_t step_idx = task.step_begin; step_idx < task.step_end; ++step_idx) {
+        auto const &step = this->steps[step_idx];
+        auto &slot_buffer = step.slot->buffer();
+
+        slot_buffer.set_frame_length(frame_length);
+        slot_buffer.clear();
+
+        step.node->render(&slot_buffer, step.bus_idx, time);
+
+        step.slot->set_rendered(time);
+    }
+}
@@ -0,0 +1,80 @@
+//
+//  yas_audio_rendering_plan.h
+//
+
+#pragma once
+
+#include <audio/yas_audio_format.h>
+#include <audio/yas_audio_pcm_buffer.h>
+#include <audio/yas_audio_pcm_buffer_pool.h>
+#include <audio/yas_audio_ptr.h>
+#include <audio/yas_audio_time.h>
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace yas::audio {
+class rendering_node;
+class rendering_connection;
+
+struct rendering_slot {
+    // the buffer is reserved in and acquired from the pool for as long as the slot lives
+    rendering_slot(pcm_buffer_pool_ptr const &, audio::format const &, uint32_t const frame_capacity);
+    ~rendering_slot();
+
+    [[nodiscard]] pcm_buffer &buffer() const;
+
+    [[nodiscard]] bool is_rendered(uint32_t const frame_length, audio::time const &) const;
+    void set_rendered(audio::time const &);
+    void reset_rendered();
+
+   private:
+    pcm_buffer_pool_ptr const _buffer_pool;
+    pcm_buffer_pool::key_t const _buffer_key;
+    pcm_buffer *const _buffer;
+    std::optional<audio::time> _rendered_time = std::nullopt;
+
+    rendering_slot(rendering_slot const &) = delete;
+    rendering_slot(rendering_slot &&) = delete;
+    rendering_slot &operator=(rendering_slot const &) = delete;
+    rendering_slot &operator=(rendering_slot &&) = delete;
+};
+
+struct rendering_step {
+    rendering_node const *node;
+    uint32_t bus_idx;
+    rendering_slot *slot;
+    uint32_t level;
+    // steps in the same task group of a level are rendered in one task
+    std::size_t task_group;
+};
+
+struct rendering_task {
+    std::size_t step_begin;
+    std::size_t step_end;
+};
+
+struct rendering_plan {
+    rendering_plan(std::vector<rendering_step> &&, std::vector<std::shared_ptr<rendering_slot>> &&,
+                   uint32_t const maximum_frames, rendering_worker_pool_ptr const & = nullptr);
+
+    std::vector<rendering_step> const steps;
+    std::vector<rendering_task> const tasks;
+    std::vector<std::size_t> const level_offsets;
+    uint32_t const maximum_frames;
+    rendering_worker_pool_ptr const worker_pool;
+
+    bool render(rendering_connection const &, pcm_buffer *const, audio::time const &) const;
+
+   private:
+    std::vector<std::shared_ptr<rendering_slot>> const _slots;
+
+    rendering_plan(rendering_plan const &) = delete;
+    rendering_plan(rendering_plan &&) = delete;
+    rendering_plan &operator=(rendering_plan const &) = delete;
+    rendering_plan &operator=(rendering_plan &&) = delete;
+
+    void _render_task(std::size_t const task_idx, uint32_t const frame_length, audio::time const &) const;
+};
+}  // namespace yas::audio
@@ -0,0 +1,198 @@
+//
+//  yas_audio_rendering_worker_pool.cpp
+//
+
+#include "yas_audio_rendering_worker_pool.h"
+
+#include <audio/yas_audio_time.h>
+#include <mach/thread_policy.h>
+#include <pthread.h>
+
+#include <limits>
+
+#if defined(__aarch64__)
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+using namespace yas;
+using namespace yas::audio;
+
+namespace yas::audio::rendering_worker_pool_utils {
+static uint32_t constexpr spin_count = 4096;
+
+static uint32_t generation(uint64_t const state) {
+    return static_cast<uint32_t>(state >> 32);
+}
+
+static void pause() {
+#if defined(__aarch64__)
+    __asm__ __volatile__("yield");
+#elif defined(__SSE2__)
+    _mm_pause();
+#endif
+}
+
+static void set_realtime_policy(std::size_t const worker_idx, uint32_t const period) {
+    thread_port_t const thread = pthread_mach_thread_np(pthread_self());
+
+    thread_time_constraint_policy_data_t time_constraint{
+        .period = period, .computation = period / 2, .constraint = period, .preemptible = true};
+    thread_policy_set(thread, THREAD_TIME_CONSTRAINT_POLICY, reinterpret_cast<thread_policy_t>(&time_constraint),
+                      THREAD_TIME_CONSTRAINT_POLICY_COUNT);
+
+    // affinity tags are only a placement hint and are ignored where the kernel does not support them
+    thread_affinity_policy_data_t affinity{.affinity_tag = static_cast<integer_t>(worker_idx + 1)};
+    thread_policy_set(thread, THREAD_AFFINITY_POLICY, reinterpret_cast<thread_policy_t>(&affinity),
+                      THREAD_AFFINITY_POLICY_COUNT);
+}
+}  // namespace yas::audio::rendering_worker_pool_utils
+
+rendering_worker_pool::rendering_worker_pool(std::size_t const worker_count, double const period) {
+    semaphore_create(mach_task_self(), &this->_semaphore, SYNC_POLICY_FIFO, 0);
+
+    uint32_t const period_host_time = static_cast<uint32_t>(host_time_for_seconds(period));
+
+    this->_threads.reserve(worker_count);
+
+    for (std::size_t idx = 0; idx < worker_count; ++idx) {
+        this->_threads.emplace_back([this, idx, period_host_time] { this->_work(idx, period_host_time); });
+    }
+}
+
+rendering_worker_pool::~rendering_worker_pool() {
+    this->_is_stopping.store(true);
+
+    uint32_t const generation = rendering_worker_pool_utils::generation(this->_state.load()) + 1;
+    this->_state.store(static_cast<uint64_t>(generation) << 32);
+
+    this->_wake_workers(this->_threads.size());
+
+    for (auto &thread : this->_threads) {
+        thread.join();
+    }
+
+    semaphore_destroy(mach_task_self(), this->_semaphore);
+}
+
+std::size_t rendering_worker_pool::worker_count() const {
+    return this->_threads.size();
+}
+
+void rendering_worker_pool::run(std::size_t const task_count, task_f const &task) {
+    if (this->_threads.empty() || task_count <= 1) {
+        for (std::size_t idx = 0; idx < task_count; ++idx) {
+            task(idx);
+        }
+        return;
+    }
+
+    uint32_t const generation = rendering_worker_pool_utils::generation(this->_state.load()) + 2;
+
+    // close the previous generation so that no worker can claim a task while the fields are replaced
+    this->_state.store((static_cast<uint64_t>(generation - 1) << 32) | std::numeric_limits<uint32_t>::max());
+
+    this->_task.store(&task, std::memory_order_relaxed);
+    this->_task_count.store(task_count, std::memory_order_relaxed);
+    this->_done_count.store(0, std::memory_order_relaxed);
+
+    this->_state.store(static_cast<uint64_t>(generation) << 32);
+
+    this->_wake_workers(task_count - 1);
+
+    while (this->_run_task(generation)) {
+    }
+
+    for (uint32_t spins = 0; this->_done_count.load(std::memory_order_acquire) < task_count; ++spins) {
+        if (spins < rendering_worker_pool_utils::spin_count) {
+            rendering_worker_pool_utils::pause();
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void rendering_worker_pool::_work(std::size_t const worker_idx, uint32_t const period) {
+    rendering_worker_pool_utils::set_realtime_policy(worker_idx, period);
+
+    uint32_t seen_generation = rendering_worker_pool_utils::generation(this->_state.load());
+
+    while (true) {
+        uint32_t generation = seen_generation;
+
+        for (uint32_t spins = 0; spins < rendering_worker_pool_utils::spin_count; ++spins) {
+            generation = rendering_worker_pool_utils::generation(this->_state.load(std::memory_order_acquire));
+            if (generation != seen_generation) {
+                break;
+            }
+            rendering_worker_pool_utils::pause();
+        }
+
+        if (this->_is_stopping.load()) {
+            return;
+        }
+
+        if (generation == seen_generation) {
+            this->_sleeping_count.fetch_add(1);
+
+            if (rendering_worker_pool_utils::generation(this->_state.load()) != seen_generation) {
+                // withdraw unless a waker has already counted this worker and signaled for it
+                int64_t count = this->_sleeping_count.load();
+                while (count > 0) {
+                    if (this->_sleeping_count.compare_exchange_weak(count, count - 1)) {
+                        break;
+                    }
+                }
+                if (count > 0) {
+                    continue;
+                }
+            }
+
+            semaphore_wait(this->_semaphore);
+            continue;
+        }
+
+        seen_generation = generation;
+
+        while (this->_run_task(generation)) {
+        }
+    }
+}
+
+bool rendering_worker_pool::_run_task(uint32_t const generation) {
+    uint64_t state = this->_state.load(std::memory_order_acquire);
+
+    while (rendering_worker_pool_utils::generation(state) == generation) {
+        std::size_t const task_idx = static_cast<uint32_t>(state);
+
+        if (task_idx >= this->_task_count.load(std::memory_order_relaxed)) {
+            return false;
+        }
+
+        if (this->_state.compare_exchange_weak(state, state + 1, std::memory_order_acq_rel,
+                                               std::memory_order_acquire)) {
+            (*this->_task.load(std::memory_order_relaxed))(task_idx);
+            this->_done_count.fetch_add(1, std::memory_order_release);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void rendering_worker_pool::_wake_workers(std::size_t const count) {
+    std::size_t remaining = count;
+    int64_t sleeping_count = this->_sleeping_count.load();
+
+    while (remaining > 0 && sleeping_count > 0) {
+        if (this->_sleeping_count.compare_exchange_weak(sleeping_count, sleeping_count - 1)) {
+            semaphore_signal(this->_semaphore);
+            --remaining;
+            --sleeping_count;
+        }
+    }
+}
+
+rendering_worker_pool_ptr rendering_worker_pool::make_shared(std::size_t const worker_count, double const period) {
+    return rendering_worker_pool_ptr(new rendering_worker_pool{worker_count, period});
+}
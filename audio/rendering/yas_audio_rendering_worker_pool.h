@@ -0,0 +1,51 @@
+//
+//  yas_audio_rendering_worker_pool.h
+//
+
+#pragma once
+
+#include <audio/yas_audio_ptr.h>
+#include <mach/mach.h>
+
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace yas::audio {
+struct rendering_worker_pool final {
+    using task_f = std::function<void(std::size_t const)>;
+
+    ~rendering_worker_pool();
+
+    [[nodiscard]] std::size_t worker_count() const;
+
+    // runs the tasks on the workers and the calling thread, and returns when all of them are done.
+    // only one thread, the render thread, may call this
+    void run(std::size_t const task_count, task_f const &);
+
+    [[nodiscard]] static rendering_worker_pool_ptr make_shared(std::size_t const worker_count,
+                                                               double const period = 0.01);
+
+   private:
+    std::vector<std::thread> _threads;
+    std::atomic<uint64_t> _state = 0;
+    std::atomic<task_f const *> _task = nullptr;
+    std::atomic<std::size_t> _task_count = 0;
+    std::atomic<std::size_t> _done_count = 0;
+    std::atomic<int64_t> _sleeping_count = 0;
+    std::atomic<bool> _is_stopping = false;
+    semaphore_t _semaphore;
+
+    rendering_worker_pool(std::size_t const worker_count, double const period);
+
+    rendering_worker_pool(rendering_worker_pool const &) = delete;
+    rendering_worker_pool(rendering_worker_pool &&) = delete;
+    rendering_worker_pool &operator=(rendering_worker_pool const &) = delete;
+    rendering_worker_pool &operator=(rendering_worker_pool &&) = delete;
+
+    void _work(std::size_t const worker_idx, uint32_t const period);
+    bool _run_task(uint32_t const generation);
+    void _wake_workers(std::size_t const count);
+};
+}  // namespace yas::audio
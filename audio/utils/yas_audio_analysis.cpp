@@ -0,0 +1,449 @@
+//
+//  yas_audio_analysis.cpp
+//
+
+#include "yas_audio_analysis.h"
+
+#include <audio/yas_audio_conversion.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#define YAS_AUDIO_ANALYSIS_NEON 1
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define YAS_AUDIO_ANALYSIS_SSE2 1
+#endif
+
+using namespace yas;
+
+namespace yas::audio::analysis_utils {
+static uint32_t constexpr block_length = 64;
+
+template <typename T>
+struct sample;
+
+template <>
+struct sample<float> {
+    static double constexpr scale = 1.0;
+};
+
+template <>
+struct sample<double> {
+    static double constexpr scale = 1.0;
+};
+
+template <>
+struct sample<int16_t> {
+    static double constexpr scale = 32768.0;
+};
+
+template <>
+struct sample<int32_t> {
+    static double constexpr scale = 16777216.0;
+};
+
+template <>
+struct sample<int24_t> {
+    static double constexpr scale = 8388608.0;
+};
+
+template <>
+struct sample<float16_t> {
+    static double constexpr scale = 1.0;
+};
+
+template <typename T>
+using value_t = std::conditional_t<std::is_same_v<T, int24_t>, int32_t,
+                                   std::conditional_t<std::is_same_v<T, float16_t>, float, T>>;
+
+template <typename T>
+using abs_t = std::conditional_t<std::is_same_v<T, int16_t> || std::is_same_v<T, int24_t>, int32_t,
+                                 std::conditional_t<std::is_same_v<T, int32_t>, int64_t, value_t<T>>>;
+
+template <typename T>
+static value_t<T> to_value(T const value) {
+    if constexpr (std::is_same_v<T, int24_t>) {
+        return to_int32(value);
+    } else if constexpr (std::is_same_v<T, float16_t>) {
+        return to_float32(value);
+    } else {
+        return value;
+    }
+}
+
+template <typename T>
+static abs_t<T> abs_value(T const value) {
+    return std::abs(static_cast<abs_t<T>>(to_value(value)));
+}
+
+template <typename T>
+static abs_t<T> to_threshold(double const threshold) {
+    double const scaled = threshold * sample<T>::scale;
+    if constexpr (std::is_floating_point_v<abs_t<T>>) {
+        return static_cast<abs_t<T>>(scaled);
+    } else {
+        return static_cast<abs_t<T>>(std::floor(std::clamp(scaled, 0.0, sample<T>::scale * 256.0)));
+    }
+}
+
+template <typename T>
+static bool is_silent_contiguous(T const *const data, uint32_t const length, abs_t<T> const threshold) {
+    uint32_t frame = 0;
+
+#if YAS_AUDIO_ANALYSIS_SSE2
+    if constexpr (std::is_same_v<T, float>) {
+        __m128 const abs_mask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+        __m128 const limit = _mm_set1_ps(threshold);
+        for (; frame + 16 <= length; frame += 16) {
+            __m128 const v0 = _mm_and_ps(_mm_loadu_ps(&data[frame]), abs_mask);
+            __m128 const v1 = _mm_and_ps(_mm_loadu_ps(&data[frame + 4]), abs_mask);
+            __m128 const v2 = _mm_and_ps(_mm_loadu_ps(&data[frame + 8]), abs_mask);
+            __m128 const v3 = _mm_and_ps(_mm_loadu_ps(&data[frame + 12]), abs_mask);
+            __m128 const over = _mm_or_ps(_mm_or_ps(_mm_cmpgt_ps(v0, limit), _mm_cmpgt_ps(v1, limit)),
+                                          _mm_or_ps(_mm_cmpgt_ps(v2, limit), _mm_cmpgt_ps(v3, limit)));
+            if (_mm_movemask_ps(over) != 0) {
+                return false;
+            }
+        }
+    } else if constexpr (std::is_same_v<T, double>) {
+        __m128d const abs_mask = _mm_castsi128_pd(_mm_set1_epi64x(0x7fffffffffffffff));
+        __m128d const limit = _mm_set1_pd(threshold);
+        for (; frame + 8 <= length; frame += 8) {
+            __m128d const v0 = _mm_and_pd(_mm_loadu_pd(&data[frame]), abs_mask);
+            __m128d const v1 = _mm_and_pd(_mm_loadu_pd(&data[frame + 2]), abs_mask);
+            __m128d const v2 = _mm_and_pd(_mm_loadu_pd(&data[frame + 4]), abs_mask);
+            __m128d const v3 = _mm_and_pd(_mm_loadu_pd(&data[frame + 6]), abs_mask);
+            __m128d const over = _mm_or_pd(_mm_or_pd(_mm_cmpgt_pd(v0, limit), _mm_cmpgt_pd(v1, limit)),
+                                           _mm_or_pd(_mm_cmpgt_pd(v2, limit), _mm_cmpgt_pd(v3, limit)));
+            if (_mm_movemask_pd(over) != 0) {
+                return false;
+            }
+        }
+    }
+#elif YAS_AUDIO_ANALYSIS_NEON
+    if constexpr (std::is_same_v<T, float>) {
+        float32x4_t const limit = vdupq_n_f32(threshold);
+        for (; frame + 16 <= length; frame += 16) {
+            uint32x4_t const over = vorrq_u32(vorrq_u32(vcagtq_f32(vld1q_f32(&data[frame]), limit),
+                                                        vcagtq_f32(vld1q_f32(&data[frame + 4]), limit)),
+                                              vorrq_u32(vcagtq_f32(vld1q_f32(&data[frame + 8]), limit),
+                                                        vcagtq_f32(vld1q_f32(&data[frame + 12]), limit)));
+            if (vmaxvq_u32(over) != 0) {
+                return false;
+            }
+        }
+    } else if constexpr (std::is_same_v<T, double>) {
+        float64x2_t const limit = vdupq_n_f64(threshold);
+        for (; frame + 8 <= length; frame += 8) {
+            uint64x2_t const over = vorrq_u64(vorrq_u64(vcagtq_f64(vld1q_f64(&data[frame]), limit),
+                                                        vcagtq_f64(vld1q_f64(&data[frame + 2]), limit)),
+                                              vorrq_u64(vcagtq_f64(vld1q_f64(&data[frame + 4]), limit),
+                                                        vcagtq_f64(vld1q_f64(&data[frame + 6]), limit)));
+            if ((vgetq_lane_u64(over, 0) | vgetq_lane_u64(over, 1)) != 0) {
+                return false;
+            }
+        }
+    }
+#endif
+
+    for (; frame + block_length <= length; frame += block_length) {
+        bool over = false;
+        for (uint32_t idx = 0; idx < block_length; ++idx) {
+            over |= abs_value(data[frame + idx]) > threshold;
+        }
+        if (over) {
+            return false;
+        }
+    }
+
+    for (; frame < length; ++frame) {
+        if (abs_value(data[frame]) > threshold) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <typename T>
+static bool is_silent(void const *const data, uint32_t const stride, uint32_t const length, double const threshold) {
+    T const *const ptr = static_cast<T const *>(data);
+    abs_t<T> const limit = to_threshold<T>(threshold);
+
+    if (stride == 1) {
+        return is_silent_contiguous(ptr, length, limit);
+    }
+
+    for (uint32_t frame = 0; frame < length; ++frame) {
+        if (abs_value(ptr[frame * stride]) > limit) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <typename T>
+static double peak(void const *const data, uint32_t const stride, uint32_t const length) {
+    T const *const ptr = static_cast<T const *>(data);
+    uint32_t frame = 0;
+    abs_t<T> max = 0;
+
+    if (stride == 1) {
+#if YAS_AUDIO_ANALYSIS_SSE2
+        if constexpr (std::is_same_v<T, float>) {
+            __m128 const abs_mask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+            __m128 max0 = _mm_setzero_ps();
+            __m128 max1 = _mm_setzero_ps();
+            for (; frame + 8 <= length; frame += 8) {
+                max0 = _mm_max_ps(max0, _mm_and_ps(_mm_loadu_ps(&ptr[frame]), abs_mask));
+                max1 = _mm_max_ps(max1, _mm_and_ps(_mm_loadu_ps(&ptr[frame + 4]), abs_mask));
+            }
+            float lanes[4];
+            _mm_storeu_ps(lanes, _mm_max_ps(max0, max1));
+            max = std::max({lanes[0], lanes[1], lanes[2], lanes[3]});
+        } else if constexpr (std::is_same_v<T, double>) {
+            __m128d const abs_mask = _mm_castsi128_pd(_mm_set1_epi64x(0x7fffffffffffffff));
+            __m128d max0 = _mm_setzero_pd();
+            __m128d max1 = _mm_setzero_pd();
+            for (; frame + 4 <= length; frame += 4) {
+                max0 = _mm_max_pd(max0, _mm_and_pd(_mm_loadu_pd(&ptr[frame]), abs_mask));
+                max1 = _mm_max_pd(max1, _mm_and_pd(_mm_loadu_pd(&ptr[frame + 2]), abs_mask));
+            }
+            double lanes[2];
+            _mm_storeu_pd(lanes, _mm_max_pd(max0, max1));
+            max = std::max(lanes[0], lanes[1]);
+        }
+#elif YAS_AUDIO_ANALYSIS_NEON
+        if constexpr (std::is_same_v<T, float>) {
+            float32x4_t max0 = vdupq_n_f32(0.0f);
+            float32x4_t max1 = vdupq_n_f32(0.0f);
+            for (; frame + 8 <= length; frame += 8) {
+                max0 = vmaxq_f32(max0, vabsq_f32(vld1q_f32(&ptr[frame])));
+                max1 = vmaxq_f32(max1, vabsq_f32(vld1q_f32(&ptr[frame + 4])));
+            }
+            max = vmaxvq_f32(vmaxq_f32(max0, max1));
+        } else if constexpr (std::is_same_v<T, double>) {
+            float64x2_t max0 = vdupq_n_f64(0.0);
+            float64x2_t max1 = vdupq_n_f64(0.0);
+            for (; frame + 4 <= length; frame += 4) {
+                max0 = vmaxq_f64(max0, vabsq_f64(vld1q_f64(&ptr[frame])));
+                max1 = vmaxq_f64(max1, vabsq_f64(vld1q_f64(&ptr[frame + 2])));
+            }
+            max = vmaxvq_f64(vmaxq_f64(max0, max1));
+        }
+#endif
+        for (; frame < length; ++frame) {
+            max = std::max(max, abs_value(ptr[frame]));
+        }
+    } else {
+        for (; frame < length; ++frame) {
+            max = std::max(max, abs_value(ptr[frame * stride]));
+        }
+    }
+
+    return static_cast<double>(max) / sample<T>::scale;
+}
+
+template <typename T>
+static double rms(void const *const data, uint32_t const stride, uint32_t const length) {
+    T const *const ptr = static_cast<T const *>(data);
+    uint32_t frame = 0;
+    double sum = 0.0;
+
+    if (stride == 1) {
+#if YAS_AUDIO_ANALYSIS_SSE2
+        if constexpr (std::is_same_v<T, float>) {
+            __m128d sum0 = _mm_setzero_pd();
+            __m128d sum1 = _mm_setzero_pd();
+            for (; frame + 4 <= length; frame += 4) {
+                __m128 const value = _mm_loadu_ps(&ptr[frame]);
+                __m128d const lo = _mm_cvtps_pd(value);
+                __m128d const hi = _mm_cvtps_pd(_mm_movehl_ps(value, value));
+                sum0 = _mm_add_pd(sum0, _mm_mul_pd(lo, lo));
+                sum1 = _mm_add_pd(sum1, _mm_mul_pd(hi, hi));
+            }
+            double lanes[2];
+            _mm_storeu_pd(lanes, _mm_add_pd(sum0, sum1));
+            sum = lanes[0] + lanes[1];
+        } else if constexpr (std::is_same_v<T, double>) {
+            __m128d sum0 = _mm_setzero_pd();
+            __m128d sum1 = _mm_setzero_pd();
+            for (; frame + 4 <= length; frame += 4) {
+                __m128d const lo = _mm_loadu_pd(&ptr[frame]);
+                __m128d const hi = _mm_loadu_pd(&ptr[frame + 2]);
+                sum0 = _mm_add_pd(sum0, _mm_mul_pd(lo, lo));
+                sum1 = _mm_add_pd(sum1, _mm_mul_pd(hi, hi));
+            }
+            double lanes[2];
+            _mm_storeu_pd(lanes, _mm_add_pd(sum0, sum1));
+            sum = lanes[0] + lanes[1];
+        }
+#elif YAS_AUDIO_ANALYSIS_NEON
+        if constexpr (std::is_same_v<T, float>) {
+            float64x2_t sum0 = vdupq_n_f64(0.0);
+            float64x2_t sum1 = vdupq_n_f64(0.0);
+            for (; frame + 4 <= length; frame += 4) {
+                float32x4_t const value = vld1q_f32(&ptr[frame]);
+                float64x2_t const lo = vcvt_f64_f32(vget_low_f32(value));
+                float64x2_t const hi = vcvt_high_f64_f32(value);
+                sum0 = vfmaq_f64(sum0, lo, lo);
+                sum1 = vfmaq_f64(sum1, hi, hi);
+            }
+            sum = vaddvq_f64(vaddq_f64(sum0, sum1));
+        } else if constexpr (std::is_same_v<T, double>) {
+            float64x2_t sum0 = vdupq_n_f64(0.0);
+            float64x2_t sum1 = vdupq_n_f64(0.0);
+            for (; frame + 4 <= length; frame += 4) {
+                float64x2_t const lo = vld1q_f64(&ptr[frame]);
+                float64x2_t const hi = vld1q_f64(&ptr[frame + 2]);
+                sum0 = vfmaq_f64(sum0, lo, lo);
+                sum1 = vfmaq_f64(sum1, hi, hi);
+            }
+            sum = vaddvq_f64(vaddq_f64(sum0, sum1));
+        }
+#endif
+    }
+
+    for (; frame < length; ++frame) {
+        double const value = static_cast<double>(to_value(ptr[frame * stride]));
+        sum += value * value;
+    }
+
+    return std::sqrt(sum / length) / sample<T>::scale;
+}
+}  // namespace yas::audio::analysis_utils
+
+bool audio::is_zero(void const *const data, std::size_t const byte_count) {
+    if (!data) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : data is null.");
+    }
+
+    uint8_t const *const bytes = static_cast<uint8_t const *>(data);
+    std::size_t idx = 0;
+
+#if YAS_AUDIO_ANALYSIS_SSE2
+    __m128i const zero = _mm_setzero_si128();
+    for (; idx + 64 <= byte_count; idx += 64) {
+        __m128i const bits = _mm_or_si128(
+            _mm_or_si128(_mm_loadu_si128(reinterpret_cast<__m128i const *>(&bytes[idx])),
+                         _mm_loadu_si128(reinterpret_cast<__m128i const *>(&bytes[idx + 16]))),
+            _mm_or_si128(_mm_loadu_si128(reinterpret_cast<__m128i const *>(&bytes[idx + 32])),
+                         _mm_loadu_si128(reinterpret_cast<__m128i const *>(&bytes[idx + 48]))));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(bits, zero)) != 0xffff) {
+            return false;
+        }
+    }
+#elif YAS_AUDIO_ANALYSIS_NEON
+    for (; idx + 64 <= byte_count; idx += 64) {
+        uint8x16_t const bits = vorrq_u8(vorrq_u8(vld1q_u8(&bytes[idx]), vld1q_u8(&bytes[idx + 16])),
+                                         vorrq_u8(vld1q_u8(&bytes[idx + 32]), vld1q_u8(&bytes[idx + 48])));
+        if (vmaxvq_u8(bits) != 0) {
+            return false;
+        }
+    }
+#endif
+
+    for (; idx + analysis_utils::block_length <= byte_count; idx += analysis_utils::block_length) {
+        uint64_t words[analysis_utils::block_length / sizeof(uint64_t)];
+        std::memcpy(words, &bytes[idx], analysis_utils::block_length);
+        uint64_t bits = 0;
+        for (uint64_t const word : words) {
+            bits |= word;
+        }
+        if (bits != 0) {
+            return false;
+        }
+    }
+
+    for (; idx < byte_count; ++idx) {
+        if (bytes[idx] != 0) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool audio::is_silent(void const *const data, uint32_t const stride, pcm_format const pcm_format,
+                      uint32_t const length, double const threshold) {
+    if (!data || stride == 0 || threshold < 0.0) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : invalid argument.");
+    }
+
+    switch (pcm_format) {
+        case pcm_format::float32:
+            return analysis_utils::is_silent<float>(data, stride, length, threshold);
+        case pcm_format::float64:
+            return analysis_utils::is_silent<double>(data, stride, length, threshold);
+        case pcm_format::int16:
+            return analysis_utils::is_silent<int16_t>(data, stride, length, threshold);
+        case pcm_format::fixed824:
+            return analysis_utils::is_silent<int32_t>(data, stride, length, threshold);
+        case pcm_format::int24:
+            return analysis_utils::is_silent<int24_t>(data, stride, length, threshold);
+        case pcm_format::float16:
+            return analysis_utils::is_silent<float16_t>(data, stride, length, threshold);
+        default:
+            throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : invalid pcm_format.");
+    }
+}
+
+double audio::peak(void const *const data, uint32_t const stride, pcm_format const pcm_format,
+                   uint32_t const length) {
+    if (!data || stride == 0) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : invalid argument.");
+    }
+
+    switch (pcm_format) {
+        case pcm_format::float32:
+            return analysis_utils::peak<float>(data, stride, length);
+        case pcm_format::float64:
+            return analysis_utils::peak<double>(data, stride, length);
+        case pcm_format::int16:
+            return analysis_utils::peak<int16_t>(data, stride, length);
+        case pcm_format::fixed824:
+            return analysis_utils::peak<int32_t>(data, stride, length);
+        case pcm_format::int24:
+            return analysis_utils::peak<int24_t>(data, stride, length);
+        case pcm_format::float16:
+            return analysis_utils::peak<float16_t>(data, stride, length);
+        default:
+            throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : invalid pcm_format.");
+    }
+}
+
+double audio::rms(void const *const data, uint32_t const stride, pcm_format const pcm_format, uint32_t const length) {
+    if (!data || stride == 0) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : invalid argument.");
+    }
+
+    if (length == 0) {
+        return 0.0;
+    }
+
+    switch (pcm_format) {
+        case pcm_format::float32:
+            return analysis_utils::rms<float>(data, stride, length);
+        case pcm_format::float64:
+            return analysis_utils::rms<double>(data, stride, length);
+        case pcm_format::int16:
+            return analysis_utils::rms<int16_t>(data, stride, length);
+        case pcm_format::fixed824:
+            return analysis_utils::rms<int32_t>(data, stride, length);
+        case pcm_format::int24:
+            return analysis_utils::rms<int24_t>(data, stride, length);
+        case pcm_format::float16:
+            return analysis_utils::rms<float16_t>(data, stride, length);
+        default:
+            throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : invalid pcm_format.");
+    }
+}
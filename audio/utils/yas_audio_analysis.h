@@ -0,0 +1,18 @@
+//
+//  yas_audio_analysis.h
+//
+
+#pragma once
+
+#include <audio/yas_audio_types.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace yas::audio {
+[[nodiscard]] bool is_zero(void const *const data, std::size_t const byte_count);
+[[nodiscard]] bool is_silent(void const *const data, uint32_t const stride, pcm_format const, uint32_t const length,
+                             double const threshold);
+[[nodiscard]] double peak(void const *const data, uint32_t const stride, pcm_format const, uint32_t const length);
+[[nodiscard]] double rms(void const *const data, uint32_t const stride, pcm_format const, uint32_t const length);
+}  // namespace yas::audio
@@ -0,0 +1,501 @@
+//
+//  yas_audio_conversion.cpp
+//
+
+#include "yas_audio_conversion.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#define YAS_AUDIO_CONVERSION_NEON 1
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define YAS_AUDIO_CONVERSION_SSE2 1
+#if defined(__F16C__)
+#include <immintrin.h>
+#define YAS_AUDIO_CONVERSION_F16C 1
+#endif
+#endif
+
+using namespace yas;
+
+namespace yas::audio::conversion_utils {
+using fixed824_t = int32_t;
+
+template <typename T>
+struct sample;
+
+template <>
+struct sample<float> {
+    static bool constexpr is_integer = false;
+
+    template <typename M>
+    static M decode(float const value) {
+        return value;
+    }
+
+    template <typename M>
+    static float encode(M const value, M const) {
+        return static_cast<float>(value);
+    }
+};
+
+template <>
+struct sample<double> {
+    static bool constexpr is_integer = false;
+
+    template <typename M>
+    static M decode(double const value) {
+        return static_cast<M>(value);
+    }
+
+    template <typename M>
+    static double encode(M const value, M const) {
+        return value;
+    }
+};
+
+template <>
+struct sample<int16_t> {
+    static bool constexpr is_integer = true;
+
+    template <typename M>
+    static M decode(int16_t const value) {
+        return static_cast<M>(value) * (M(1) / M(32768));
+    }
+
+    template <typename M>
+    static int16_t encode(M const value, M const dither) {
+        M const scaled = std::clamp(value * M(32768) + dither, M(-32768), M(32767));
+        return static_cast<int16_t>(std::lrint(scaled));
+    }
+};
+
+template <>
+struct sample<fixed824_t> {
+    static bool constexpr is_integer = true;
+
+    template <typename M>
+    static M decode(fixed824_t const value) {
+        return static_cast<M>(value) * (M(1) / M(16777216));
+    }
+
+    template <typename M>
+    static fixed824_t encode(M const value, M const dither) {
+        M const scaled = std::clamp(value * M(16777216) + dither, M(-2147483648.0), M(2147483647.0));
+        return static_cast<fixed824_t>(std::lrint(scaled));
+    }
+};
+
+template <>
+struct sample<int24_t> {
+    static bool constexpr is_integer = true;
+
+    template <typename M>
+    static M decode(int24_t const value) {
+        return static_cast<M>(to_int32(value)) * (M(1) / M(8388608));
+    }
+
+    template <typename M>
+    static int24_t encode(M const value, M const dither) {
+        M const scaled = std::clamp(value * M(8388608) + dither, M(-8388608), M(8388607));
+        return to_int24(static_cast<int32_t>(std::lrint(scaled)));
+    }
+};
+
+template <>
+struct sample<float16_t> {
+    static bool constexpr is_integer = false;
+
+    template <typename M>
+    static M decode(float16_t const value) {
+        return static_cast<M>(to_float32(value));
+    }
+
+    template <typename M>
+    static float16_t encode(M const value, M const) {
+        return to_float16(static_cast<float>(value));
+    }
+};
+
+template <typename From, typename To>
+using mid_t = std::conditional_t<std::is_same_v<From, double> || std::is_same_v<To, double> ||
+                                     std::is_same_v<From, fixed824_t> || std::is_same_v<To, fixed824_t>,
+                                 double, float>;
+
+template <typename From, typename To>
+bool constexpr is_narrowing = (std::is_same_v<To, int16_t> && !std::is_same_v<From, int16_t>) ||
+                              (std::is_same_v<To, fixed824_t> && std::is_same_v<From, double>) ||
+                              (std::is_same_v<To, int24_t> && !std::is_same_v<From, int24_t> &&
+                               !std::is_same_v<From, int16_t> && !std::is_same_v<From, float16_t>);
+
+struct tpdf_dither {
+    explicit tpdf_dither(uint32_t const seed) : _state(seed ?: 0x9e3779b9) {
+    }
+
+    template <typename M>
+    M next() {
+        this->_state ^= this->_state << 13;
+        this->_state ^= this->_state >> 17;
+        this->_state ^= this->_state << 5;
+        int32_t const diff = static_cast<int32_t>(this->_state & 0xffff) - static_cast<int32_t>(this->_state >> 16);
+        return static_cast<M>(diff) * static_cast<M>(1.0 / 65536.0);
+    }
+
+   private:
+    uint32_t _state;
+};
+
+static uint32_t next_dither_seed() {
+    static thread_local uint32_t seed = 0x12345678;
+    seed = seed * 1664525u + 1013904223u;
+    return seed;
+}
+
+#if YAS_AUDIO_CONVERSION_SSE2
+#if !YAS_AUDIO_CONVERSION_F16C
+static __m128 half_to_float(__m128i const value) {
+    __m128i const exp_mant = _mm_and_si128(value, _mm_set1_epi32(0x7fff));
+    __m128i const sign = _mm_slli_epi32(_mm_xor_si128(value, exp_mant), 16);
+    __m128 const scaled =
+        _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(exp_mant, 13)), _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23)));
+    __m128i const is_inf_nan = _mm_cmpgt_epi32(exp_mant, _mm_set1_epi32(0x7bff));
+    __m128i const inf_nan_exp = _mm_and_si128(is_inf_nan, _mm_set1_epi32(255 << 23));
+    return _mm_or_ps(scaled, _mm_castsi128_ps(_mm_or_si128(sign, inf_nan_exp)));
+}
+
+static __m128i float_to_half(__m128 const value) {
+    __m128i const subnormal_magic = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+
+    __m128 const sign = _mm_and_ps(value, _mm_castsi128_ps(_mm_set1_epi32(0x80000000u)));
+    __m128 const abs = _mm_xor_ps(value, sign);
+    __m128i const abs_bits = _mm_castps_si128(abs);
+
+    __m128i const is_nan = _mm_castps_si128(_mm_cmpunord_ps(abs, abs));
+    __m128i const is_regular = _mm_cmpgt_epi32(_mm_set1_epi32((127 + 16) << 23), abs_bits);
+    __m128i const inf_nan = _mm_or_si128(_mm_and_si128(is_nan, _mm_set1_epi32(0x200)), _mm_set1_epi32(0x7c00));
+    __m128i const is_subnormal = _mm_cmpgt_epi32(_mm_set1_epi32((127 - 14) << 23), abs_bits);
+
+    __m128i const subnormal =
+        _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(abs, _mm_castsi128_ps(subnormal_magic))), subnormal_magic);
+
+    __m128i const mant_odd = _mm_srai_epi32(_mm_slli_epi32(abs_bits, 31 - 13), 31);
+    __m128i const rounded = _mm_add_epi32(abs_bits, _mm_set1_epi32(static_cast<int32_t>(0xfffu - (112u << 23))));
+    __m128i const normal = _mm_srli_epi32(_mm_sub_epi32(rounded, mant_odd), 13);
+
+    __m128i const finite =
+        _mm_or_si128(_mm_and_si128(subnormal, is_subnormal), _mm_andnot_si128(is_subnormal, normal));
+    __m128i const joined = _mm_or_si128(_mm_and_si128(finite, is_regular), _mm_andnot_si128(is_regular, inf_nan));
+    return _mm_or_si128(joined, _mm_srai_epi32(_mm_castps_si128(sign), 16));
+}
+#endif
+#elif YAS_AUDIO_CONVERSION_NEON
+static int32x4_t join_int24(uint16x4_t const low, int16x4_t const high) {
+    return vorrq_s32(vshlq_n_s32(vmovl_s16(high), 16), vreinterpretq_s32_u32(vmovl_u16(low)));
+}
+#endif
+
+template <typename From, typename To>
+static uint32_t convert_simd(From const *const from, To *const to, uint32_t const length) {
+    uint32_t frame = 0;
+
+#if YAS_AUDIO_CONVERSION_SSE2
+    if constexpr (std::is_same_v<From, int16_t> && std::is_same_v<To, float>) {
+        __m128 const scale = _mm_set1_ps(1.0f / 32768.0f);
+        for (; frame + 8 <= length; frame += 8) {
+            __m128i const value = _mm_loadu_si128(reinterpret_cast<__m128i const *>(&from[frame]));
+            __m128i const lo = _mm_srai_epi32(_mm_unpacklo_epi16(value, value), 16);
+            __m128i const hi = _mm_srai_epi32(_mm_unpackhi_epi16(value, value), 16);
+            _mm_storeu_ps(&to[frame], _mm_mul_ps(_mm_cvtepi32_ps(lo), scale));
+            _mm_storeu_ps(&to[frame + 4], _mm_mul_ps(_mm_cvtepi32_ps(hi), scale));
+        }
+    } else if constexpr (std::is_same_v<From, float> && std::is_same_v<To, int16_t>) {
+        __m128 const scale = _mm_set1_ps(32768.0f);
+        __m128 const min = _mm_set1_ps(-32768.0f);
+        __m128 const max = _mm_set1_ps(32767.0f);
+        for (; frame + 8 <= length; frame += 8) {
+            __m128 const lo = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(&from[frame]), scale), min), max);
+            __m128 const hi = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(&from[frame + 4]), scale), min), max);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(&to[frame]),
+                             _mm_packs_epi32(_mm_cvtps_epi32(lo), _mm_cvtps_epi32(hi)));
+        }
+    } else if constexpr (std::is_same_v<From, fixed824_t> && std::is_same_v<To, float>) {
+        __m128 const scale = _mm_set1_ps(1.0f / 16777216.0f);
+        for (; frame + 4 <= length; frame += 4) {
+            __m128i const value = _mm_loadu_si128(reinterpret_cast<__m128i const *>(&from[frame]));
+            _mm_storeu_ps(&to[frame], _mm_mul_ps(_mm_cvtepi32_ps(value), scale));
+        }
+    } else if constexpr (std::is_same_v<From, float> && std::is_same_v<To, fixed824_t>) {
+        __m128 const scale = _mm_set1_ps(16777216.0f);
+        __m128 const min = _mm_set1_ps(-2147483648.0f);
+        __m128 const overflow = _mm_set1_ps(2147483648.0f);
+        __m128i const max = _mm_set1_epi32(INT32_MAX);
+        for (; frame + 4 <= length; frame += 4) {
+            __m128 const value = _mm_max_ps(_mm_mul_ps(_mm_loadu_ps(&from[frame]), scale), min);
+            __m128i const is_overflow = _mm_castps_si128(_mm_cmpge_ps(value, overflow));
+            __m128i const converted = _mm_cvtps_epi32(value);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(&to[frame]),
+                             _mm_or_si128(_mm_andnot_si128(is_overflow, converted), _mm_and_si128(is_overflow, max)));
+        }
+    } else if constexpr (std::is_same_v<From, float> && std::is_same_v<To, double>) {
+        for (; frame + 4 <= length; frame += 4) {
+            __m128 const value = _mm_loadu_ps(&from[frame]);
+            _mm_storeu_pd(&to[frame], _mm_cvtps_pd(value));
+            _mm_storeu_pd(&to[frame + 2], _mm_cvtps_pd(_mm_movehl_ps(value, value)));
+        }
+    } else if constexpr (std::is_same_v<From, double> && std::is_same_v<To, float>) {
+        for (; frame + 4 <= length; frame += 4) {
+            __m128 const lo = _mm_cvtpd_ps(_mm_loadu_pd(&from[frame]));
+            __m128 const hi = _mm_cvtpd_ps(_mm_loadu_pd(&from[frame + 2]));
+            _mm_storeu_ps(&to[frame], _mm_movelh_ps(lo, hi));
+        }
+    } else if constexpr (std::is_same_v<From, int24_t> && std::is_same_v<To, float>) {
+        __m128 const scale = _mm_set1_ps(1.0f / 8388608.0f);
+        for (; frame + 6 <= length; frame += 4) {
+            __m128i const bytes = _mm_loadu_si128(reinterpret_cast<__m128i const *>(&from[frame]));
+            __m128i const lo = _mm_unpacklo_epi32(bytes, _mm_srli_si128(bytes, 3));
+            __m128i const hi = _mm_unpacklo_epi32(_mm_srli_si128(bytes, 6), _mm_srli_si128(bytes, 9));
+            __m128i const value = _mm_srai_epi32(_mm_slli_epi32(_mm_unpacklo_epi64(lo, hi), 8), 8);
+            _mm_storeu_ps(&to[frame], _mm_mul_ps(_mm_cvtepi32_ps(value), scale));
+        }
+    } else if constexpr (std::is_same_v<From, float> && std::is_same_v<To, int24_t>) {
+        __m128 const scale = _mm_set1_ps(8388608.0f);
+        __m128 const min = _mm_set1_ps(-8388608.0f);
+        __m128 const max = _mm_set1_ps(8388607.0f);
+        __m128i const even_mask = _mm_set_epi32(0, 0xffffff, 0, 0xffffff);
+        __m128i const odd_mask = _mm_set_epi32(0xffffff, 0, 0xffffff, 0);
+        __m128i const low_mask = _mm_set_epi32(0, 0, -1, -1);
+        for (; frame + 4 <= length; frame += 4) {
+            __m128 const clamped = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(&from[frame]), scale), min), max);
+            __m128i const value = _mm_cvtps_epi32(clamped);
+            __m128i const pairs =
+                _mm_or_si128(_mm_and_si128(value, even_mask), _mm_srli_epi64(_mm_and_si128(value, odd_mask), 8));
+            __m128i const packed =
+                _mm_or_si128(_mm_and_si128(pairs, low_mask), _mm_srli_si128(_mm_andnot_si128(low_mask, pairs), 2));
+            uint8_t *const bytes = reinterpret_cast<uint8_t *>(&to[frame]);
+            int32_t const tail = _mm_cvtsi128_si32(_mm_srli_si128(packed, 8));
+            _mm_storel_epi64(reinterpret_cast<__m128i *>(bytes), packed);
+            std::memcpy(&bytes[8], &tail, sizeof(int32_t));
+        }
+    } else if constexpr (std::is_same_v<From, float16_t> && std::is_same_v<To, float>) {
+        for (; frame + 8 <= length; frame += 8) {
+            __m128i const value = _mm_loadu_si128(reinterpret_cast<__m128i const *>(&from[frame]));
+#if YAS_AUDIO_CONVERSION_F16C
+            _mm_storeu_ps(&to[frame], _mm_cvtph_ps(value));
+            _mm_storeu_ps(&to[frame + 4], _mm_cvtph_ps(_mm_srli_si128(value, 8)));
+#else
+            __m128i const zero = _mm_setzero_si128();
+            _mm_storeu_ps(&to[frame], half_to_float(_mm_unpacklo_epi16(value, zero)));
+            _mm_storeu_ps(&to[frame + 4], half_to_float(_mm_unpackhi_epi16(value, zero)));
+#endif
+        }
+    } else if constexpr (std::is_same_v<From, float> && std::is_same_v<To, float16_t>) {
+        for (; frame + 8 <= length; frame += 8) {
+            __m128 const lo = _mm_loadu_ps(&from[frame]);
+            __m128 const hi = _mm_loadu_ps(&from[frame + 4]);
+#if YAS_AUDIO_CONVERSION_F16C
+            __m128i const value = _mm_unpacklo_epi64(_mm_cvtps_ph(lo, _MM_FROUND_TO_NEAREST_INT),
+                                                     _mm_cvtps_ph(hi, _MM_FROUND_TO_NEAREST_INT));
+#else
+            __m128i const value = _mm_packs_epi32(float_to_half(lo), float_to_half(hi));
+#endif
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(&to[frame]), value);
+        }
+    }
+#elif YAS_AUDIO_CONVERSION_NEON
+    if constexpr (std::is_same_v<From, int16_t> && std::is_same_v<To, float>) {
+        for (; frame + 8 <= length; frame += 8) {
+            int16x8_t const value = vld1q_s16(&from[frame]);
+            vst1q_f32(&to[frame], vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(value))), 1.0f / 32768.0f));
+            vst1q_f32(&to[frame + 4], vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(value))), 1.0f / 32768.0f));
+        }
+    } else if constexpr (std::is_same_v<From, float> && std::is_same_v<To, int16_t>) {
+        float32x4_t const min = vdupq_n_f32(-32768.0f);
+        float32x4_t const max = vdupq_n_f32(32767.0f);
+        for (; frame + 8 <= length; frame += 8) {
+            float32x4_t const lo = vminq_f32(vmaxq_f32(vmulq_n_f32(vld1q_f32(&from[frame]), 32768.0f), min), max);
+            float32x4_t const hi = vminq_f32(vmaxq_f32(vmulq_n_f32(vld1q_f32(&from[frame + 4]), 32768.0f), min), max);
+            vst1q_s16(&to[frame], vcombine_s16(vqmovn_s32(vcvtnq_s32_f32(lo)), vqmovn_s32(vcvtnq_s32_f32(hi))));
+        }
+    } else if constexpr (std::is_same_v<From, fixed824_t> && std::is_same_v<To, float>) {
+        for (; frame + 4 <= length; frame += 4) {
+            vst1q_f32(&to[frame], vmulq_n_f32(vcvtq_f32_s32(vld1q_s32(&from[frame])), 1.0f / 16777216.0f));
+        }
+    } else if constexpr (std::is_same_v<From, float> && std::is_same_v<To, fixed824_t>) {
+        for (; frame + 4 <= length; frame += 4) {
+            vst1q_s32(&to[frame], vcvtnq_s32_f32(vmulq_n_f32(vld1q_f32(&from[frame]), 16777216.0f)));
+        }
+    } else if constexpr (std::is_same_v<From, float> && std::is_same_v<To, double>) {
+        for (; frame + 4 <= length; frame += 4) {
+            float32x4_t const value = vld1q_f32(&from[frame]);
+            vst1q_f64(&to[frame], vcvt_f64_f32(vget_low_f32(value)));
+            vst1q_f64(&to[frame + 2], vcvt_high_f64_f32(value));
+        }
+    } else if constexpr (std::is_same_v<From, double> && std::is_same_v<To, float>) {
+        for (; frame + 4 <= length; frame += 4) {
+            float32x2_t const lo = vcvt_f32_f64(vld1q_f64(&from[frame]));
+            vst1q_f32(&to[frame], vcvt_high_f32_f64(lo, vld1q_f64(&from[frame + 2])));
+        }
+    } else if constexpr (std::is_same_v<From, int24_t> && std::is_same_v<To, float>) {
+        for (; frame + 16 <= length; frame += 16) {
+            uint8x16x3_t const bytes = vld3q_u8(reinterpret_cast<uint8_t const *>(&from[frame]));
+            uint16x8_t const low0 =
+                vorrq_u16(vmovl_u8(vget_low_u8(bytes.val[0])), vshll_n_u8(vget_low_u8(bytes.val[1]), 8));
+            uint16x8_t const low1 = vorrq_u16(vmovl_high_u8(bytes.val[0]), vshll_high_n_u8(bytes.val[1], 8));
+            int16x8_t const high0 = vmovl_s8(vget_low_s8(vreinterpretq_s8_u8(bytes.val[2])));
+            int16x8_t const high1 = vmovl_high_s8(vreinterpretq_s8_u8(bytes.val[2]));
+            float const scale = 1.0f / 8388608.0f;
+            vst1q_f32(&to[frame],
+                      vmulq_n_f32(vcvtq_f32_s32(join_int24(vget_low_u16(low0), vget_low_s16(high0))), scale));
+            vst1q_f32(&to[frame + 4],
+                      vmulq_n_f32(vcvtq_f32_s32(join_int24(vget_high_u16(low0), vget_high_s16(high0))), scale));
+            vst1q_f32(&to[frame + 8],
+                      vmulq_n_f32(vcvtq_f32_s32(join_int24(vget_low_u16(low1), vget_low_s16(high1))), scale));
+            vst1q_f32(&to[frame + 12],
+                      vmulq_n_f32(vcvtq_f32_s32(join_int24(vget_high_u16(low1), vget_high_s16(high1))), scale));
+        }
+    } else if constexpr (std::is_same_v<From, float> && std::is_same_v<To, int24_t>) {
+        float32x4_t const min = vdupq_n_f32(-8388608.0f);
+        float32x4_t const max = vdupq_n_f32(8388607.0f);
+        for (; frame + 16 <= length; frame += 16) {
+            uint32x4_t values[4];
+            for (uint32_t idx = 0; idx < 4; ++idx) {
+                float32x4_t const value = vmulq_n_f32(vld1q_f32(&from[frame + idx * 4]), 8388608.0f);
+                values[idx] = vreinterpretq_u32_s32(vcvtnq_s32_f32(vminq_f32(vmaxq_f32(value, min), max)));
+            }
+            uint16x8_t const low0 = vcombine_u16(vmovn_u32(values[0]), vmovn_u32(values[1]));
+            uint16x8_t const low1 = vcombine_u16(vmovn_u32(values[2]), vmovn_u32(values[3]));
+            uint16x8_t const high0 = vcombine_u16(vshrn_n_u32(values[0], 16), vshrn_n_u32(values[1], 16));
+            uint16x8_t const high1 = vcombine_u16(vshrn_n_u32(values[2], 16), vshrn_n_u32(values[3], 16));
+            uint8x16x3_t bytes;
+            bytes.val[0] = vcombine_u8(vmovn_u16(low0), vmovn_u16(low1));
+            bytes.val[1] = vcombine_u8(vshrn_n_u16(low0, 8), vshrn_n_u16(low1, 8));
+            bytes.val[2] = vcombine_u8(vmovn_u16(high0), vmovn_u16(high1));
+            vst3q_u8(reinterpret_cast<uint8_t *>(&to[frame]), bytes);
+        }
+    } else if constexpr (std::is_same_v<From, float16_t> && std::is_same_v<To, float>) {
+        for (; frame + 8 <= length; frame += 8) {
+            uint16x8_t const bits = vld1q_u16(reinterpret_cast<uint16_t const *>(&from[frame]));
+            float16x8_t const value = vreinterpretq_f16_u16(bits);
+            vst1q_f32(&to[frame], vcvt_f32_f16(vget_low_f16(value)));
+            vst1q_f32(&to[frame + 4], vcvt_high_f32_f16(value));
+        }
+    } else if constexpr (std::is_same_v<From, float> && std::is_same_v<To, float16_t>) {
+        for (; frame + 8 <= length; frame += 8) {
+            float16x4_t const lo = vcvt_f16_f32(vld1q_f32(&from[frame]));
+            float16x8_t const value = vcvt_high_f16_f32(lo, vld1q_f32(&from[frame + 4]));
+            vst1q_u16(reinterpret_cast<uint16_t *>(&to[frame]), vreinterpretq_u16_f16(value));
+        }
+    }
+#endif
+
+    return frame;
+}
+
+template <typename From, typename To>
+static void convert(void const *const from_data, uint32_t const from_stride, void *const to_data,
+                    uint32_t const to_stride, uint32_t const length, bool const dither) {
+    using M = mid_t<From, To>;
+
+    From const *const from = static_cast<From const *>(from_data);
+    To *const to = static_cast<To *>(to_data);
+
+    if constexpr (is_narrowing<From, To>) {
+        if (dither) {
+            tpdf_dither tpdf(next_dither_seed());
+            for (uint32_t frame = 0; frame < length; ++frame) {
+                M const value = sample<From>::template decode<M>(from[frame * from_stride]);
+                to[frame * to_stride] = sample<To>::template encode<M>(value, tpdf.next<M>());
+            }
+            return;
+        }
+    }
+
+    uint32_t frame = 0;
+
+    if (from_stride == 1 && to_stride == 1) {
+        frame = convert_simd(from, to, length);
+    }
+
+    for (; frame < length; ++frame) {
+        M const value = sample<From>::template decode<M>(from[frame * from_stride]);
+        to[frame * to_stride] = sample<To>::template encode<M>(value, M(0));
+    }
+}
+
+template <typename From>
+static void convert(void const *const from_data, uint32_t const from_stride, void *const to_data,
+                    uint32_t const to_stride, pcm_format const to_pcm_format, uint32_t const length,
+                    bool const dither) {
+    switch (to_pcm_format) {
+        case pcm_format::float32:
+            convert<From, float>(from_data, from_stride, to_data, to_stride, length, dither);
+            break;
+        case pcm_format::float64:
+            convert<From, double>(from_data, from_stride, to_data, to_stride, length, dither);
+            break;
+        case pcm_format::int16:
+            convert<From, int16_t>(from_data, from_stride, to_data, to_stride, length, dither);
+            break;
+        case pcm_format::fixed824:
+            convert<From, fixed824_t>(from_data, from_stride, to_data, to_stride, length, dither);
+            break;
+        case pcm_format::int24:
+            convert<From, int24_t>(from_data, from_stride, to_data, to_stride, length, dither);
+            break;
+        case pcm_format::float16:
+            convert<From, float16_t>(from_data, from_stride, to_data, to_stride, length, dither);
+            break;
+        case pcm_format::other:
+            throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : invalid pcm_format.");
+    }
+}
+}  // namespace yas::audio::conversion_utils
+
+void audio::convert(void const *const from_data, uint32_t const from_stride, pcm_format const from_pcm_format,
+                    void *const to_data, uint32_t const to_stride, pcm_format const to_pcm_format,
+                    uint32_t const length, bool const dither) {
+    if (!from_data || !to_data || from_stride == 0 || to_stride == 0) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : invalid argument.");
+    }
+
+    if (length == 0) {
+        return;
+    }
+
+    switch (from_pcm_format) {
+        case pcm_format::float32:
+            conversion_utils::convert<float>(from_data, from_stride, to_data, to_stride, to_pcm_format, length,
+                                             dither);
+            break;
+        case pcm_format::float64:
+            conversion_utils::convert<double>(from_data, from_stride, to_data, to_stride, to_pcm_format, length,
+                                              dither);
+            break;
+        case pcm_format::int16:
+            conversion_utils::convert<int16_t>(from_data, from_stride, to_data, to_stride, to_pcm_format, length,
+                                               dither);
+            break;
+        case pcm_format::fixed824:
+            conversion_utils::convert<conversion_utils::fixed824_t>(from_data, from_stride, to_data, to_stride,
+                                                                    to_pcm_format, length, dither);
+            break;
+        case pcm_format::int24:
+            conversion_utils::convert<int24_t>(from_data, from_stride, to_data, to_stride, to_pcm_format, length,
+                                               dither);
+            break;
+        case pcm_format::float16:
+            conversion_utils::convert<float16_t>(from_data, from_stride, to_data, to_stride, to_pcm_format, length,
+                                                 dither);
+            break;
+        case pcm_format::other:
+            throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : invalid pcm_format.");
+    }
+}
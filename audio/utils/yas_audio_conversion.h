@@ -0,0 +1,22 @@
+//
+//  yas_audio_conversion.h
+//
+
+#pragma once
+
+#include <audio/yas_audio_types.h>
+
+#include <cstdint>
+
+namespace yas::audio {
+void convert(void const *const from_data, uint32_t const from_stride, pcm_format const from_pcm_format,
+             void *const to_data, uint32_t const to_stride, pcm_format const to_pcm_format, uint32_t const length,
+             bool const dither = false);
+
+[[nodiscard]] int32_t to_int32(int24_t const);
+[[nodiscard]] int24_t to_int24(int32_t const);
+[[nodiscard]] float to_float32(float16_t const);
+[[nodiscard]] float16_t to_float16(float const);
+}  // namespace yas::audio
+
+#include <audio/yas_audio_conversion_private.h>
@@ -0,0 +1,77 @@
+//
+//  yas_audio_conversion_private.h
+//
+
+#pragma once
+
+#include <cstring>
+
+namespace yas::audio::conversion_utils {
+inline uint32_t to_bits(float const value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(uint32_t));
+    return bits;
+}
+
+inline float to_float(uint32_t const bits) {
+    float value;
+    std::memcpy(&value, &bits, sizeof(float));
+    return value;
+}
+}  // namespace yas::audio::conversion_utils
+
+namespace yas::audio {
+inline int32_t to_int32(int24_t const value) {
+    uint32_t const bits = static_cast<uint32_t>(value.bytes[0]) | (static_cast<uint32_t>(value.bytes[1]) << 8) |
+                          (static_cast<uint32_t>(value.bytes[2]) << 16);
+    return static_cast<int32_t>(bits << 8) >> 8;
+}
+
+inline int24_t to_int24(int32_t const value) {
+    uint32_t const bits = static_cast<uint32_t>(value);
+    return int24_t{.bytes = {static_cast<uint8_t>(bits), static_cast<uint8_t>(bits >> 8),
+                             static_cast<uint8_t>(bits >> 16)}};
+}
+
+inline float to_float32(float16_t const value) {
+    uint32_t constexpr shifted_exp = 0x7c00 << 13;
+
+    uint32_t bits = (value.bits & 0x7fff) << 13;
+    uint32_t const exp = bits & shifted_exp;
+    bits += (127 - 15) << 23;
+
+    if (exp == shifted_exp) {
+        bits += (128 - 16) << 23;
+    } else if (exp == 0) {
+        bits += 1 << 23;
+        bits = conversion_utils::to_bits(conversion_utils::to_float(bits) - conversion_utils::to_float(113 << 23));
+    }
+
+    return conversion_utils::to_float(bits | (static_cast<uint32_t>(value.bits & 0x8000) << 16));
+}
+
+inline float16_t to_float16(float const value) {
+    uint32_t constexpr f16_max = (127 + 16) << 23;
+    uint32_t constexpr min_normal = (127 - 14) << 23;
+    uint32_t constexpr subnormal_magic = ((127 - 15) + (23 - 10) + 1) << 23;
+
+    uint32_t bits = conversion_utils::to_bits(value);
+    uint32_t const sign = bits & 0x80000000u;
+    bits ^= sign;
+
+    uint32_t result;
+
+    if (bits >= f16_max) {
+        result = bits > 0x7f800000u ? 0x7e00 : 0x7c00;
+    } else if (bits < min_normal) {
+        float const shifted = conversion_utils::to_float(bits) + conversion_utils::to_float(subnormal_magic);
+        result = conversion_utils::to_bits(shifted) - subnormal_magic;
+    } else {
+        uint32_t const mant_odd = (bits >> 13) & 1;
+        bits += (static_cast<uint32_t>(15 - 127) << 23) + 0xfff + mant_odd;
+        result = bits >> 13;
+    }
+
+    return float16_t{.bits = static_cast<uint16_t>(result | (sign >> 16))};
+}
+}  // namespace yas::audio
@@ -4,8 +4,12 @@
 
 #pragma once
 
+#include <audio/yas_audio_types.h>
 #include <cpp_utils/yas_each_data.h>
 
+#include <array>
+#include <cstddef>
+
 namespace yas::audio {
 class pcm_buffer;
 
@@ -14,6 +18,51 @@ each_data<T> make_each_data(pcm_buffer &buffer);
 
 template <typename T>
 const_each_data<T> make_each_data(pcm_buffer const &buffer);
+
+template <typename T>
+struct inline_each_data final {
+    static std::size_t constexpr capacity = inline_buffer_capacity;
+
+    std::array<T *, capacity> ptrs;
+    std::size_t ptr_count;
+    std::size_t stride;
+    std::size_t frame_length;
+
+    [[nodiscard]] std::size_t channel_count() const;
+    [[nodiscard]] T *ptr_at_channel(std::size_t const ch_idx) const;
+};
+
+template <typename T>
+struct each_block final {
+    each_block(inline_each_data<T> const &, std::size_t const block_length);
+
+    [[nodiscard]] bool next();
+
+    [[nodiscard]] T *ptr() const;
+    [[nodiscard]] std::size_t stride() const;
+    [[nodiscard]] std::size_t length() const;
+    [[nodiscard]] std::size_t channel_index() const;
+    [[nodiscard]] std::size_t frame_index() const;
+
+   private:
+    inline_each_data<T> _data;
+    std::size_t _block_length;
+    std::size_t _frm_idx = 0;
+    std::size_t _ch_idx = 0;
+    bool _is_started = false;
+};
+
+template <typename T>
+inline_each_data<T> make_inline_each_data(pcm_buffer &buffer);
+
+template <typename T>
+inline_each_data<T const> make_inline_each_data(pcm_buffer const &buffer);
+
+template <typename T>
+each_block<T> make_each_block(pcm_buffer &buffer, std::size_t const block_length);
+
+template <typename T>
+each_block<T const> make_each_block(pcm_buffer const &buffer, std::size_t const block_length);
 }  // namespace yas::audio
 
 #include <audio/yas_audio_each_data_private.h>
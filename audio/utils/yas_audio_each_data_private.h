@@ -8,6 +8,37 @@
 #include <audio/yas_audio_pcm_buffer.h>
 #include <cpp_utils/yas_fast_each.h>
 
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+namespace yas::audio::each_data_utils {
+template <typename T, typename Buffer>
+inline_each_data<T> make_inline_each_data(Buffer &buffer) {
+    auto const &format = buffer.format();
+    std::size_t const buffer_count = format.buffer_count();
+
+    if (buffer_count > inline_each_data<T>::capacity) {
+        throw std::overflow_error(std::string(__PRETTY_FUNCTION__) + " : buffer count is overflow(" +
+                                  std::to_string(buffer_count) + ")");
+    }
+
+    inline_each_data<T> data{.ptrs = {},
+                             .ptr_count = buffer_count,
+                             .stride = format.stride(),
+                             .frame_length = buffer.frame_length()};
+
+    auto each = make_fast_each(buffer_count);
+    while (yas_each_next(each)) {
+        auto const &idx = yas_each_index(each);
+        data.ptrs[idx] = buffer.template data_ptr_at_index<std::remove_const_t<T>>(static_cast<uint32_t>(idx));
+    }
+
+    return data;
+}
+}  // namespace yas::audio::each_data_utils
+
 namespace yas::audio {
 template <typename T>
 each_data<T> make_each_data(pcm_buffer &buffer) {
@@ -40,4 +71,84 @@ const_each_data<T> make_each_data(pcm_buffer const &buffer) {
 
     return yas::make_each_data<T>(vec.data(), buffer.frame_length(), format.buffer_count(), format.stride());
 }
+
+template <typename T>
+std::size_t inline_each_data<T>::channel_count() const {
+    return this->ptr_count * this->stride;
+}
+
+template <typename T>
+T *inline_each_data<T>::ptr_at_channel(std::size_t const ch_idx) const {
+    return this->ptrs[ch_idx / this->stride] + ch_idx % this->stride;
+}
+
+template <typename T>
+each_block<T>::each_block(inline_each_data<T> const &data, std::size_t const block_length)
+    : _data(data), _block_length(block_length) {
+    if (block_length == 0) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : block_length is zero.");
+    }
+}
+
+template <typename T>
+bool each_block<T>::next() {
+    if (!this->_is_started) {
+        this->_is_started = true;
+        return this->_data.frame_length > 0 && this->_data.ptr_count > 0;
+    }
+
+    if (++this->_ch_idx < this->_data.channel_count()) {
+        return true;
+    }
+
+    this->_ch_idx = 0;
+    this->_frm_idx += this->_block_length;
+
+    return this->_frm_idx < this->_data.frame_length;
+}
+
+template <typename T>
+T *each_block<T>::ptr() const {
+    return this->_data.ptr_at_channel(this->_ch_idx) + this->_frm_idx * this->_data.stride;
+}
+
+template <typename T>
+std::size_t each_block<T>::stride() const {
+    return this->_data.stride;
+}
+
+template <typename T>
+std::size_t each_block<T>::length() const {
+    return std::min(this->_block_length, this->_data.frame_length - this->_frm_idx);
+}
+
+template <typename T>
+std::size_t each_block<T>::channel_index() const {
+    return this->_ch_idx;
+}
+
+template <typename T>
+std::size_t each_block<T>::frame_index() const {
+    return this->_frm_idx;
+}
+
+template <typename T>
+inline_each_data<T> make_inline_each_data(pcm_buffer &buffer) {
+    return each_data_utils::make_inline_each_data<T>(buffer);
+}
+
+template <typename T>
+inline_each_data<T const> make_inline_each_data(pcm_buffer const &buffer) {
+    return each_data_utils::make_inline_each_data<T const>(buffer);
+}
+
+template <typename T>
+each_block<T> make_each_block(pcm_buffer &buffer, std::size_t const block_length) {
+    return each_block<T>{make_inline_each_data<T>(buffer), block_length};
+}
+
+template <typename T>
+each_block<T const> make_each_block(pcm_buffer const &buffer, std::size_t const block_length) {
+    return each_block<T const>{make_inline_each_data<T>(buffer), block_length};
+}
 }  // namespace yas::audio
@@ -0,0 +1,412 @@
+//
+//  yas_audio_interleave.cpp
+//
+
+#include "yas_audio_interleave.h"
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define YAS_AUDIO_INTERLEAVE_NEON 1
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define YAS_AUDIO_INTERLEAVE_SSE2 1
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define YAS_AUDIO_INTERLEAVE_AVX2 1
+#endif
+#endif
+
+using namespace yas;
+
+namespace yas::audio::interleave_utils {
+#if YAS_AUDIO_INTERLEAVE_SSE2
+static void transpose(__m128 &v0, __m128 &v1, __m128 &v2, __m128 &v3) {
+    _MM_TRANSPOSE4_PS(v0, v1, v2, v3);
+}
+#elif YAS_AUDIO_INTERLEAVE_NEON
+static void transpose(uint32x4_t &v0, uint32x4_t &v1, uint32x4_t &v2, uint32x4_t &v3) {
+    uint32x4x2_t const t01 = vtrnq_u32(v0, v1);
+    uint32x4x2_t const t23 = vtrnq_u32(v2, v3);
+    v0 = vcombine_u32(vget_low_u32(t01.val[0]), vget_low_u32(t23.val[0]));
+    v1 = vcombine_u32(vget_low_u32(t01.val[1]), vget_low_u32(t23.val[1]));
+    v2 = vcombine_u32(vget_high_u32(t01.val[0]), vget_high_u32(t23.val[0]));
+    v3 = vcombine_u32(vget_high_u32(t01.val[1]), vget_high_u32(t23.val[1]));
+}
+#endif
+
+template <typename T, uint32_t N>
+static uint32_t deinterleave_simd(T const *const from, T *const *const to, uint32_t const length) {
+    uint32_t frame = 0;
+
+#if YAS_AUDIO_INTERLEAVE_SSE2
+    if constexpr (sizeof(T) == 4 && N == 2) {
+#if YAS_AUDIO_INTERLEAVE_AVX2
+        for (; frame + 8 <= length; frame += 8) {
+            __m256 const a = _mm256_loadu_ps(reinterpret_cast<float const *>(&from[frame * 2]));
+            __m256 const b = _mm256_loadu_ps(reinterpret_cast<float const *>(&from[frame * 2 + 8]));
+            __m256d const ch0 = _mm256_permute4x64_pd(
+                _mm256_castps_pd(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0))), _MM_SHUFFLE(3, 1, 2, 0));
+            __m256d const ch1 = _mm256_permute4x64_pd(
+                _mm256_castps_pd(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1))), _MM_SHUFFLE(3, 1, 2, 0));
+            _mm256_storeu_pd(reinterpret_cast<double *>(&to[0][frame]), ch0);
+            _mm256_storeu_pd(reinterpret_cast<double *>(&to[1][frame]), ch1);
+        }
+#endif
+        for (; frame + 4 <= length; frame += 4) {
+            __m128 const a = _mm_loadu_ps(reinterpret_cast<float const *>(&from[frame * 2]));
+            __m128 const b = _mm_loadu_ps(reinterpret_cast<float const *>(&from[frame * 2 + 4]));
+            _mm_storeu_ps(reinterpret_cast<float *>(&to[0][frame]), _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)));
+            _mm_storeu_ps(reinterpret_cast<float *>(&to[1][frame]), _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+        }
+    } else if constexpr (sizeof(T) == 4 && (N == 4 || N == 8)) {
+        for (; frame + 4 <= length; frame += 4) {
+            for (uint32_t ch = 0; ch < N; ch += 4) {
+                __m128 v0 = _mm_loadu_ps(reinterpret_cast<float const *>(&from[frame * N + ch]));
+                __m128 v1 = _mm_loadu_ps(reinterpret_cast<float const *>(&from[(frame + 1) * N + ch]));
+                __m128 v2 = _mm_loadu_ps(reinterpret_cast<float const *>(&from[(frame + 2) * N + ch]));
+                __m128 v3 = _mm_loadu_ps(reinterpret_cast<float const *>(&from[(frame + 3) * N + ch]));
+                transpose(v0, v1, v2, v3);
+                _mm_storeu_ps(reinterpret_cast<float *>(&to[ch][frame]), v0);
+                _mm_storeu_ps(reinterpret_cast<float *>(&to[ch + 1][frame]), v1);
+                _mm_storeu_ps(reinterpret_cast<float *>(&to[ch + 2][frame]), v2);
+                _mm_storeu_ps(reinterpret_cast<float *>(&to[ch + 3][frame]), v3);
+            }
+        }
+    } else if constexpr (sizeof(T) == 2 && N == 2) {
+        auto const split = [](__m128i v) {
+            v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(3, 1, 2, 0));
+            v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(3, 1, 2, 0));
+            return _mm_shuffle_epi32(v, _MM_SHUFFLE(3, 1, 2, 0));
+        };
+
+        for (; frame + 8 <= length; frame += 8) {
+            __m128i const a = split(_mm_loadu_si128(reinterpret_cast<__m128i const *>(&from[frame * 2])));
+            __m128i const b = split(_mm_loadu_si128(reinterpret_cast<__m128i const *>(&from[frame * 2 + 8])));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(&to[0][frame]), _mm_unpacklo_epi64(a, b));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(&to[1][frame]), _mm_unpackhi_epi64(a, b));
+        }
+    } else if constexpr (sizeof(T) == 8 && N == 2) {
+        for (; frame + 2 <= length; frame += 2) {
+            __m128i const a = _mm_loadu_si128(reinterpret_cast<__m128i const *>(&from[frame * 2]));
+            __m128i const b = _mm_loadu_si128(reinterpret_cast<__m128i const *>(&from[frame * 2 + 2]));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(&to[0][frame]), _mm_unpacklo_epi64(a, b));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(&to[1][frame]), _mm_unpackhi_epi64(a, b));
+        }
+    }
+#elif YAS_AUDIO_INTERLEAVE_NEON
+    if constexpr (sizeof(T) == 4 && N == 2) {
+        for (; frame + 4 <= length; frame += 4) {
+            uint32x4x2_t const v = vld2q_u32(reinterpret_cast<uint32_t const *>(&from[frame * 2]));
+            vst1q_u32(reinterpret_cast<uint32_t *>(&to[0][frame]), v.val[0]);
+            vst1q_u32(reinterpret_cast<uint32_t *>(&to[1][frame]), v.val[1]);
+        }
+    } else if constexpr (sizeof(T) == 4 && N == 4) {
+        for (; frame + 4 <= length; frame += 4) {
+            uint32x4x4_t const v = vld4q_u32(reinterpret_cast<uint32_t const *>(&from[frame * 4]));
+            for (uint32_t ch = 0; ch < 4; ++ch) {
+                vst1q_u32(reinterpret_cast<uint32_t *>(&to[ch][frame]), v.val[ch]);
+            }
+        }
+    } else if constexpr (sizeof(T) == 4 && N == 8) {
+        for (; frame + 4 <= length; frame += 4) {
+            for (uint32_t ch = 0; ch < N; ch += 4) {
+                uint32x4_t v0 = vld1q_u32(reinterpret_cast<uint32_t const *>(&from[frame * N + ch]));
+                uint32x4_t v1 = vld1q_u32(reinterpret_cast<uint32_t const *>(&from[(frame + 1) * N + ch]));
+                uint32x4_t v2 = vld1q_u32(reinterpret_cast<uint32_t const *>(&from[(frame + 2) * N + ch]));
+                uint32x4_t v3 = vld1q_u32(reinterpret_cast<uint32_t const *>(&from[(frame + 3) * N + ch]));
+                transpose(v0, v1, v2, v3);
+                vst1q_u32(reinterpret_cast<uint32_t *>(&to[ch][frame]), v0);
+                vst1q_u32(reinterpret_cast<uint32_t *>(&to[ch + 1][frame]), v1);
+                vst1q_u32(reinterpret_cast<uint32_t *>(&to[ch + 2][frame]), v2);
+                vst1q_u32(reinterpret_cast<uint32_t *>(&to[ch + 3][frame]), v3);
+            }
+        }
+    } else if constexpr (sizeof(T) == 2 && N == 2) {
+        for (; frame + 8 <= length; frame += 8) {
+            uint16x8x2_t const v = vld2q_u16(reinterpret_cast<uint16_t const *>(&from[frame * 2]));
+            vst1q_u16(reinterpret_cast<uint16_t *>(&to[0][frame]), v.val[0]);
+            vst1q_u16(reinterpret_cast<uint16_t *>(&to[1][frame]), v.val[1]);
+        }
+    } else if constexpr (sizeof(T) == 2 && N == 4) {
+        for (; frame + 8 <= length; frame += 8) {
+            uint16x8x4_t const v = vld4q_u16(reinterpret_cast<uint16_t const *>(&from[frame * 4]));
+            for (uint32_t ch = 0; ch < 4; ++ch) {
+                vst1q_u16(reinterpret_cast<uint16_t *>(&to[ch][frame]), v.val[ch]);
+            }
+        }
+    }
+#endif
+
+    return frame;
+}
+
+template <typename T, uint32_t N>
+static uint32_t interleave_simd(T const *const *const from, T *const to, uint32_t const length) {
+    uint32_t frame = 0;
+
+#if YAS_AUDIO_INTERLEAVE_SSE2
+    if constexpr (sizeof(T) == 4 && N == 2) {
+#if YAS_AUDIO_INTERLEAVE_AVX2
+        for (; frame + 8 <= length; frame += 8) {
+            __m256 const ch0 = _mm256_loadu_ps(reinterpret_cast<float const *>(&from[0][frame]));
+            __m256 const ch1 = _mm256_loadu_ps(reinterpret_cast<float const *>(&from[1][frame]));
+            __m256 const lo = _mm256_unpacklo_ps(ch0, ch1);
+            __m256 const hi = _mm256_unpackhi_ps(ch0, ch1);
+            _mm256_storeu_ps(reinterpret_cast<float *>(&to[frame * 2]), _mm256_permute2f128_ps(lo, hi, 0x20));
+            _mm256_storeu_ps(reinterpret_cast<float *>(&to[frame * 2 + 8]), _mm256_permute2f128_ps(lo, hi, 0x31));
+        }
+#endif
+        for (; frame + 4 <= length; frame += 4) {
+            __m128 const ch0 = _mm_loadu_ps(reinterpret_cast<float const *>(&from[0][frame]));
+            __m128 const ch1 = _mm_loadu_ps(reinterpret_cast<float const *>(&from[1][frame]));
+            _mm_storeu_ps(reinterpret_cast<float *>(&to[frame * 2]), _mm_unpacklo_ps(ch0, ch1));
+            _mm_storeu_ps(reinterpret_cast<float *>(&to[frame * 2 + 4]), _mm_unpackhi_ps(ch0, ch1));
+        }
+    } else if constexpr (sizeof(T) == 4 && (N == 4 || N == 8)) {
+        for (; frame + 4 <= length; frame += 4) {
+            for (uint32_t ch = 0; ch < N; ch += 4) {
+                __m128 v0 = _mm_loadu_ps(reinterpret_cast<float const *>(&from[ch][frame]));
+                __m128 v1 = _mm_loadu_ps(reinterpret_cast<float const *>(&from[ch + 1][frame]));
+                __m128 v2 = _mm_loadu_ps(reinterpret_cast<float const *>(&from[ch + 2][frame]));
+                __m128 v3 = _mm_loadu_ps(reinterpret_cast<float const *>(&from[ch + 3][frame]));
+                transpose(v0, v1, v2, v3);
+                _mm_storeu_ps(reinterpret_cast<float *>(&to[frame * N + ch]), v0);
+                _mm_storeu_ps(reinterpret_cast<float *>(&to[(frame + 1) * N + ch]), v1);
+                _mm_storeu_ps(reinterpret_cast<float *>(&to[(frame + 2) * N + ch]), v2);
+                _mm_storeu_ps(reinterpret_cast<float *>(&to[(frame + 3) * N + ch]), v3);
+            }
+        }
+    } else if constexpr (sizeof(T) == 2 && N == 2) {
+        for (; frame + 8 <= length; frame += 8) {
+            __m128i const ch0 = _mm_loadu_si128(reinterpret_cast<__m128i const *>(&from[0][frame]));
+            __m128i const ch1 = _mm_loadu_si128(reinterpret_cast<__m128i const *>(&from[1][frame]));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(&to[frame * 2]), _mm_unpacklo_epi16(ch0, ch1));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(&to[frame * 2 + 8]), _mm_unpackhi_epi16(ch0, ch1));
+        }
+    } else if constexpr (sizeof(T) == 8 && N == 2) {
+        for (; frame + 2 <= length; frame += 2) {
+            __m128i const ch0 = _mm_loadu_si128(reinterpret_cast<__m128i const *>(&from[0][frame]));
+            __m128i const ch1 = _mm_loadu_si128(reinterpret_cast<__m128i const *>(&from[1][frame]));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(&to[frame * 2]), _mm_unpacklo_epi64(ch0, ch1));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(&to[frame * 2 + 2]), _mm_unpackhi_epi64(ch0, ch1));
+        }
+    }
+#elif YAS_AUDIO_INTERLEAVE_NEON
+    if constexpr (sizeof(T) == 4 && N == 2) {
+        for (; frame + 4 <= length; frame += 4) {
+            uint32x4x2_t const v{{vld1q_u32(reinterpret_cast<uint32_t const *>(&from[0][frame])),
+                                  vld1q_u32(reinterpret_cast<uint32_t const *>(&from[1][frame]))}};
+            vst2q_u32(reinterpret_cast<uint32_t *>(&to[frame * 2]), v);
+        }
+    } else if constexpr (sizeof(T) == 4 && N == 4) {
+        for (; frame + 4 <= length; frame += 4) {
+            uint32x4x4_t const v{{vld1q_u32(reinterpret_cast<uint32_t const *>(&from[0][frame])),
+                                  vld1q_u32(reinterpret_cast<uint32_t const *>(&from[1][frame])),
+                                  vld1q_u32(reinterpret_cast<uint32_t const *>(&from[2][frame])),
+                                  vld1q_u32(reinterpret_cast<uint32_t const *>(&from[3][frame]))}};
+            vst4q_u32(reinterpret_cast<uint32_t *>(&to[frame * 4]), v);
+        }
+    } else if constexpr (sizeof(T) == 4 && N == 8) {
+        for (; frame + 4 <= length; frame += 4) {
+            for (uint32_t ch = 0; ch < N; ch += 4) {
+                uint32x4_t v0 = vld1q_u32(reinterpret_cast<uint32_t const *>(&from[ch][frame]));
+                uint32x4_t v1 = vld1q_u32(reinterpret_cast<uint32_t const *>(&from[ch + 1][frame]));
+                uint32x4_t v2 = vld1q_u32(reinterpret_cast<uint32_t const *>(&from[ch + 2][frame]));
+                uint32x4_t v3 = vld1q_u32(reinterpret_cast<uint32_t const *>(&from[ch + 3][frame]));
+                transpose(v0, v1, v2, v3);
+                vst1q_u32(reinterpret_cast<uint32_t *>(&to[frame * N + ch]), v0);
+                vst1q_u32(reinterpret_cast<uint32_t *>(&to[(frame + 1) * N + ch]), v1);
+                vst1q_u32(reinterpret_cast<uint32_t *>(&to[(frame + 2) * N + ch]), v2);
+                vst1q_u32(reinterpret_cast<uint32_t *>(&to[(frame + 3) * N + ch]), v3);
+            }
+        }
+    } else if constexpr (sizeof(T) == 2 && N == 2) {
+        for (; frame + 8 <= length; frame += 8) {
+            uint16x8x2_t const v{{vld1q_u16(reinterpret_cast<uint16_t const *>(&from[0][frame])),
+                                  vld1q_u16(reinterpret_cast<uint16_t const *>(&from[1][frame]))}};
+            vst2q_u16(reinterpret_cast<uint16_t *>(&to[frame * 2]), v);
+        }
+    } else if constexpr (sizeof(T) == 2 && N == 4) {
+        for (; frame + 8 <= length; frame += 8) {
+            uint16x8x4_t const v{{vld1q_u16(reinterpret_cast<uint16_t const *>(&from[0][frame])),
+                                  vld1q_u16(reinterpret_cast<uint16_t const *>(&from[1][frame])),
+                                  vld1q_u16(reinterpret_cast<uint16_t const *>(&from[2][frame])),
+                                  vld1q_u16(reinterpret_cast<uint16_t const *>(&from[3][frame]))}};
+            vst4q_u16(reinterpret_cast<uint16_t *>(&to[frame * 4]), v);
+        }
+    }
+#endif
+
+    return frame;
+}
+
+template <typename T, uint32_t N>
+static void deinterleave(void const *const from_data, void *const *const to_datas, uint32_t const length) {
+    T const *const from = static_cast<T const *>(from_data);
+    T *to[N];
+    for (uint32_t ch = 0; ch < N; ++ch) {
+        to[ch] = static_cast<T *>(to_datas[ch]);
+    }
+
+    for (uint32_t frame = deinterleave_simd<T, N>(from, to, length); frame < length; ++frame) {
+        T const *const frame_data = &from[frame * N];
+        for (uint32_t ch = 0; ch < N; ++ch) {
+            to[ch][frame] = frame_data[ch];
+        }
+    }
+}
+
+template <typename T, uint32_t N>
+static void interleave(void const *const *const from_datas, void *const to_data, uint32_t const length) {
+    T const *from[N];
+    for (uint32_t ch = 0; ch < N; ++ch) {
+        from[ch] = static_cast<T const *>(from_datas[ch]);
+    }
+    T *const to = static_cast<T *>(to_data);
+
+    for (uint32_t frame = interleave_simd<T, N>(from, to, length); frame < length; ++frame) {
+        T *const frame_data = &to[frame * N];
+        for (uint32_t ch = 0; ch < N; ++ch) {
+            frame_data[ch] = from[ch][frame];
+        }
+    }
+}
+
+template <typename T>
+static void deinterleave(void const *const from_data, void *const *const to_datas, uint32_t const channel_count,
+                         uint32_t const length) {
+    switch (channel_count) {
+        case 2:
+            deinterleave<T, 2>(from_data, to_datas, length);
+            break;
+        case 4:
+            deinterleave<T, 4>(from_data, to_datas, length);
+            break;
+        case 6:
+            deinterleave<T, 6>(from_data, to_datas, length);
+            break;
+        case 8:
+            deinterleave<T, 8>(from_data, to_datas, length);
+            break;
+        default: {
+            T const *const from = static_cast<T const *>(from_data);
+            for (uint32_t ch = 0; ch < channel_count; ++ch) {
+                T *const to = static_cast<T *>(to_datas[ch]);
+                for (uint32_t frame = 0; frame < length; ++frame) {
+                    to[frame] = from[frame * channel_count + ch];
+                }
+            }
+        } break;
+    }
+}
+
+template <typename T>
+static void interleave(void const *const *const from_datas, void *const to_data, uint32_t const channel_count,
+                       uint32_t const length) {
+    switch (channel_count) {
+        case 2:
+            interleave<T, 2>(from_datas, to_data, length);
+            break;
+        case 4:
+            interleave<T, 4>(from_datas, to_data, length);
+            break;
+        case 6:
+            interleave<T, 6>(from_datas, to_data, length);
+            break;
+        case 8:
+            interleave<T, 8>(from_datas, to_data, length);
+            break;
+        default: {
+            T *const to = static_cast<T *>(to_data);
+            for (uint32_t ch = 0; ch < channel_count; ++ch) {
+                T const *const from = static_cast<T const *>(from_datas[ch]);
+                for (uint32_t frame = 0; frame < length; ++frame) {
+                    to[frame * channel_count + ch] = from[frame];
+                }
+            }
+        } break;
+    }
+}
+}  // namespace yas::audio::interleave_utils
+
+void audio::deinterleave(void const *const from_data, void *const *const to_datas, uint32_t const channel_count,
+                         uint32_t const length, uint32_t const sample_byte_count) {
+    if (!from_data || !to_datas || channel_count == 0 || sample_byte_count == 0) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : invalid argument.");
+    }
+
+    if (length == 0) {
+        return;
+    }
+
+    if (channel_count == 1) {
+        memcpy(to_datas[0], from_data, length * sample_byte_count);
+        return;
+    }
+
+    switch (sample_byte_count) {
+        case 2:
+            interleave_utils::deinterleave<uint16_t>(from_data, to_datas, channel_count, length);
+            break;
+        case 4:
+            interleave_utils::deinterleave<uint32_t>(from_data, to_datas, channel_count, length);
+            break;
+        case 8:
+            interleave_utils::deinterleave<uint64_t>(from_data, to_datas, channel_count, length);
+            break;
+        default: {
+            uint8_t const *const from = static_cast<uint8_t const *>(from_data);
+            uint32_t const frame_byte_count = channel_count * sample_byte_count;
+            for (uint32_t ch = 0; ch < channel_count; ++ch) {
+                uint8_t *const to = static_cast<uint8_t *>(to_datas[ch]);
+                for (uint32_t frame = 0; frame < length; ++frame) {
+                    memcpy(&to[frame * sample_byte_count], &from[frame * frame_byte_count + ch * sample_byte_count],
+                           sample_byte_count);
+                }
+            }
+        } break;
+    }
+}
+
+void audio::interleave(void const *const *const from_datas, void *const to_data, uint32_t const channel_count,
+                       uint32_t const length, uint32_t const sample_byte_count) {
+    if (!from_datas || !to_data || channel_count == 0 || sample_byte_count == 0) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : invalid argument.");
+    }
+
+    if (length == 0) {
+        return;
+    }
+
+    if (channel_count == 1) {
+        memcpy(to_data, from_datas[0], length * sample_byte_count);
+        return;
+    }
+
+    switch (sample_byte_count) {
+        case 2:
+            interleave_utils::interleave<uint16_t>(from_datas, to_data, channel_count, length);
+            break;
+        case 4:
+            interleave_utils::interleave<uint32_t>(from_datas, to_data, channel_count, length);
+            break;
+        case 8:
+            interleave_utils::interleave<uint64_t>(from_datas, to_data, channel_count, length);
+            break;
+        default: {
+            uint8_t *const to = static_cast<uint8_t *>(to_data);
+            uint32_t const frame_byte_count = channel_count * sample_byte_count;
+            for (uint32_t ch = 0; ch < channel_count; ++ch) {
+                uint8_t const *const from = static_cast<uint8_t const *>(from_datas[ch]);
+                for (uint32_t frame = 0; frame < length; ++frame) {
+                    memcpy(&to[frame * frame_byte_count + ch * sample_byte_count], &from[frame * sample_byte_count],
+                           sample_byte_count);
+                }
+            }
+        } break;
+    }
+}
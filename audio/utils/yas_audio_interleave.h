@@ -0,0 +1,14 @@
+//
+//  yas_audio_interleave.h
+//
+
+#pragma once
+
+#include <cstdint>
+
+namespace yas::audio {
+void deinterleave(void const *const from_data, void *const *const to_datas, uint32_t const channel_count,
+                  uint32_t const length, uint32_t const sample_byte_count);
+void interleave(void const *const *const from_datas, void *const to_data, uint32_t const channel_count,
+                uint32_t const length, uint32_t const sample_byte_count);
+}  // namespace yas::audio
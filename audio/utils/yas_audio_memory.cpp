@@ -0,0 +1,90 @@
+//
+//  yas_audio_memory.cpp
+//
+
+#include "yas_audio_memory.h"
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cstdint>
+
+using namespace yas;
+
+namespace yas::audio::memory_utils {
+static std::atomic<std::size_t> _locked_byte_count{0};
+static std::atomic<std::size_t> _lock_failed_byte_count{0};
+
+struct page_range {
+    void *data;
+    std::size_t byte_count;
+};
+
+static page_range page_range_for(void *const data, std::size_t const byte_count) {
+    std::uintptr_t const page_mask = ~static_cast<std::uintptr_t>(audio::memory::page_size() - 1);
+    std::uintptr_t const begin = reinterpret_cast<std::uintptr_t>(data) & page_mask;
+    std::uintptr_t const end = (reinterpret_cast<std::uintptr_t>(data) + byte_count + ~page_mask) & page_mask;
+    return page_range{.data = reinterpret_cast<void *>(begin), .byte_count = static_cast<std::size_t>(end - begin)};
+}
+
+static void prefault(void *const data, std::size_t const byte_count) {
+    std::size_t const page_size = audio::memory::page_size();
+    volatile uint8_t *const bytes = static_cast<uint8_t *>(data);
+
+    for (std::size_t idx = 0; idx < byte_count; idx += page_size) {
+        bytes[idx] = bytes[idx];
+    }
+
+    if (byte_count > 0) {
+        bytes[byte_count - 1] = bytes[byte_count - 1];
+    }
+}
+}  // namespace yas::audio::memory_utils
+
+std::size_t audio::memory::page_size() {
+    static std::size_t const page_size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    return page_size;
+}
+
+std::size_t audio::memory::page_aligned_size(std::size_t const byte_count) {
+    std::size_t const page_size = memory::page_size();
+    return (byte_count + page_size - 1) / page_size * page_size;
+}
+
+bool audio::memory::lock(void *const data, std::size_t const byte_count) {
+    if (!data || byte_count == 0) {
+        return false;
+    }
+
+    auto const range = memory_utils::page_range_for(data, byte_count);
+
+    memory_utils::prefault(range.data, range.byte_count);
+
+    if (mlock(range.data, range.byte_count) != 0) {
+        memory_utils::_lock_failed_byte_count += range.byte_count;
+        return false;
+    }
+
+    memory_utils::_locked_byte_count += range.byte_count;
+    return true;
+}
+
+void audio::memory::unlock(void *const data, std::size_t const byte_count) {
+    if (!data || byte_count == 0) {
+        return;
+    }
+
+    auto const range = memory_utils::page_range_for(data, byte_count);
+
+    munlock(range.data, range.byte_count);
+    memory_utils::_locked_byte_count -= range.byte_count;
+}
+
+std::size_t audio::memory::locked_byte_count() {
+    return memory_utils::_locked_byte_count.load();
+}
+
+std::size_t audio::memory::lock_failed_byte_count() {
+    return memory_utils::_lock_failed_byte_count.load();
+}
@@ -0,0 +1,19 @@
+//
+//  yas_audio_memory.h
+//
+
+#pragma once
+
+#include <cstddef>
+
+namespace yas::audio::memory {
+[[nodiscard]] std::size_t page_size();
+[[nodiscard]] std::size_t page_aligned_size(std::size_t const byte_count);
+
+// locking works on whole pages and does not nest, so the data should not share pages with other locked data
+[[nodiscard]] bool lock(void *const data, std::size_t const byte_count);
+void unlock(void *const data, std::size_t const byte_count);
+
+[[nodiscard]] std::size_t locked_byte_count();
+[[nodiscard]] std::size_t lock_failed_byte_count();
+}  // namespace yas::audio::memory
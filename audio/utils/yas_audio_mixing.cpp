@@ -0,0 +1,197 @@
+//
+//  yas_audio_mixing.cpp
+//
+
+#include "yas_audio_mixing.h"
+
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#define YAS_AUDIO_MIXING_NEON 1
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define YAS_AUDIO_MIXING_SSE2 1
+#endif
+
+using namespace yas;
+
+namespace yas::audio::mixing_utils {
+template <typename T>
+static uint32_t add_simd(T const *const from, T *const to, uint32_t const length, T const gain_start,
+                         T const gain_step) {
+    uint32_t frame = 0;
+
+#if YAS_AUDIO_MIXING_SSE2
+    if constexpr (std::is_same_v<T, float>) {
+        __m128 const step = _mm_set1_ps(gain_step * 4.0f);
+        __m128 gain = _mm_add_ps(_mm_set1_ps(gain_start),
+                                 _mm_mul_ps(_mm_set1_ps(gain_step), _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f)));
+        for (; frame + 4 <= length; frame += 4) {
+            __m128 const value = _mm_mul_ps(_mm_loadu_ps(&from[frame]), gain);
+            _mm_storeu_ps(&to[frame], _mm_add_ps(_mm_loadu_ps(&to[frame]), value));
+            gain = _mm_add_ps(gain, step);
+        }
+    } else if constexpr (std::is_same_v<T, double>) {
+        __m128d const step = _mm_set1_pd(gain_step * 2.0);
+        __m128d gain = _mm_setr_pd(gain_start, gain_start + gain_step);
+        for (; frame + 2 <= length; frame += 2) {
+            __m128d const value = _mm_mul_pd(_mm_loadu_pd(&from[frame]), gain);
+            _mm_storeu_pd(&to[frame], _mm_add_pd(_mm_loadu_pd(&to[frame]), value));
+            gain = _mm_add_pd(gain, step);
+        }
+    }
+#elif YAS_AUDIO_MIXING_NEON
+    if constexpr (std::is_same_v<T, float>) {
+        float32x4_t const step = vdupq_n_f32(gain_step * 4.0f);
+        float const offsets[4] = {0.0f, 1.0f, 2.0f, 3.0f};
+        float32x4_t gain = vmlaq_n_f32(vdupq_n_f32(gain_start), vld1q_f32(offsets), gain_step);
+        for (; frame + 4 <= length; frame += 4) {
+            vst1q_f32(&to[frame], vmlaq_f32(vld1q_f32(&to[frame]), vld1q_f32(&from[frame]), gain));
+            gain = vaddq_f32(gain, step);
+        }
+    } else if constexpr (std::is_same_v<T, double>) {
+        float64x2_t const step = vdupq_n_f64(gain_step * 2.0);
+        double const gains[2] = {gain_start, gain_start + gain_step};
+        float64x2_t gain = vld1q_f64(gains);
+        for (; frame + 2 <= length; frame += 2) {
+            vst1q_f64(&to[frame], vfmaq_f64(vld1q_f64(&to[frame]), vld1q_f64(&from[frame]), gain));
+            gain = vaddq_f64(gain, step);
+        }
+    }
+#endif
+
+    return frame;
+}
+
+template <typename T>
+static uint32_t apply_gain_simd(T *const data, uint32_t const length, T const gain_start, T const gain_step) {
+    uint32_t frame = 0;
+
+#if YAS_AUDIO_MIXING_SSE2
+    if constexpr (std::is_same_v<T, float>) {
+        __m128 const step = _mm_set1_ps(gain_step * 4.0f);
+        __m128 gain = _mm_add_ps(_mm_set1_ps(gain_start),
+                                 _mm_mul_ps(_mm_set1_ps(gain_step), _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f)));
+        for (; frame + 4 <= length; frame += 4) {
+            _mm_storeu_ps(&data[frame], _mm_mul_ps(_mm_loadu_ps(&data[frame]), gain));
+            gain = _mm_add_ps(gain, step);
+        }
+    } else if constexpr (std::is_same_v<T, double>) {
+        __m128d const step = _mm_set1_pd(gain_step * 2.0);
+        __m128d gain = _mm_setr_pd(gain_start, gain_start + gain_step);
+        for (; frame + 2 <= length; frame += 2) {
+            _mm_storeu_pd(&data[frame], _mm_mul_pd(_mm_loadu_pd(&data[frame]), gain));
+            gain = _mm_add_pd(gain, step);
+        }
+    }
+#elif YAS_AUDIO_MIXING_NEON
+    if constexpr (std::is_same_v<T, float>) {
+        float32x4_t const step = vdupq_n_f32(gain_step * 4.0f);
+        float const offsets[4] = {0.0f, 1.0f, 2.0f, 3.0f};
+        float32x4_t gain = vmlaq_n_f32(vdupq_n_f32(gain_start), vld1q_f32(offsets), gain_step);
+        for (; frame + 4 <= length; frame += 4) {
+            vst1q_f32(&data[frame], vmulq_f32(vld1q_f32(&data[frame]), gain));
+            gain = vaddq_f32(gain, step);
+        }
+    } else if constexpr (std::is_same_v<T, double>) {
+        float64x2_t const step = vdupq_n_f64(gain_step * 2.0);
+        double const gains[2] = {gain_start, gain_start + gain_step};
+        float64x2_t gain = vld1q_f64(gains);
+        for (; frame + 2 <= length; frame += 2) {
+            vst1q_f64(&data[frame], vmulq_f64(vld1q_f64(&data[frame]), gain));
+            gain = vaddq_f64(gain, step);
+        }
+    }
+#endif
+
+    return frame;
+}
+
+template <typename T>
+static void add_with_gain(void const *const from_data, uint32_t const from_stride, void *const to_data,
+                          uint32_t const to_stride, uint32_t const length, double const gain_start,
+                          double const gain_end) {
+    T const *const from = static_cast<T const *>(from_data);
+    T *const to = static_cast<T *>(to_data);
+    T const start = static_cast<T>(gain_start);
+    T const step = static_cast<T>((gain_end - gain_start) / length);
+
+    uint32_t frame = 0;
+
+    if (from_stride == 1 && to_stride == 1) {
+        frame = add_simd(from, to, length, start, step);
+    }
+
+    for (; frame < length; ++frame) {
+        to[frame * to_stride] += from[frame * from_stride] * (start + step * static_cast<T>(frame));
+    }
+}
+
+template <typename T>
+static void apply_gain(void *const data, uint32_t const stride, uint32_t const length, double const gain_start,
+                       double const gain_end) {
+    T *const ptr = static_cast<T *>(data);
+    T const start = static_cast<T>(gain_start);
+    T const step = static_cast<T>((gain_end - gain_start) / length);
+
+    uint32_t frame = 0;
+
+    if (stride == 1) {
+        frame = apply_gain_simd(ptr, length, start, step);
+    }
+
+    for (; frame < length; ++frame) {
+        ptr[frame * stride] *= start + step * static_cast<T>(frame);
+    }
+}
+}  // namespace yas::audio::mixing_utils
+
+void audio::add_with_gain(void const *const from_data, uint32_t const from_stride, void *const to_data,
+                          uint32_t const to_stride, pcm_format const pcm_format, uint32_t const length,
+                          double const gain_start, double const gain_end) {
+    if (!from_data || !to_data || from_stride == 0 || to_stride == 0) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : invalid argument.");
+    }
+
+    if (length == 0) {
+        return;
+    }
+
+    switch (pcm_format) {
+        case pcm_format::float32:
+            mixing_utils::add_with_gain<float>(from_data, from_stride, to_data, to_stride, length, gain_start,
+                                               gain_end);
+            break;
+        case pcm_format::float64:
+            mixing_utils::add_with_gain<double>(from_data, from_stride, to_data, to_stride, length, gain_start,
+                                                gain_end);
+            break;
+        default:
+            throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : invalid pcm_format.");
+    }
+}
+
+void audio::apply_gain(void *const data, uint32_t const stride, pcm_format const pcm_format, uint32_t const length,
+                       double const gain_start, double const gain_end) {
+    if (!data || stride == 0) {
+        throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : invalid argument.");
+    }
+
+    if (length == 0) {
+        return;
+    }
+
+    switch (pcm_format) {
+        case pcm_format::float32:
+            mixing_utils::apply_gain<float>(data, stride, length, gain_start, gain_end);
+            break;
+        case pcm_format::float64:
+            mixing_utils::apply_gain<double>(data, stride, length, gain_start, gain_end);
+            break;
+        default:
+            throw std::invalid_argument(std::string(__PRETTY_FUNCTION__) + " : invalid pcm_format.");
+    }
+}
@@ -0,0 +1,17 @@
+//
+//  yas_audio_mixing.h
+//
+
+#pragma once
+
+#include <audio/yas_audio_types.h>
+
+#include <cstdint>
+
+namespace yas::audio {
+void add_with_gain(void const *const from_data, uint32_t const from_stride, void *const to_data,
+                   uint32_t const to_stride, pcm_format const, uint32_t const length, double const gain_start,
+                   double const gain_end);
+void apply_gain(void *const data, uint32_t const stride, pcm_format const, uint32_t const length,
+                double const gain_start, double const gain_end);
+}  // namespace yas::audio
@@ -70,6 +70,8 @@ AVAudioCommonFormat yas::to_common_format(pcm_format const pcm_format) {
             return AVAudioPCMFormatInt32;
         case pcm_format::int16:
             return AVAudioPCMFormatInt16;
+        case pcm_format::int24:
+        case pcm_format::float16:
         case pcm_format::other:
             return AVAudioOtherFormat;
     }
@@ -4,18 +4,31 @@
 
 #pragma once
 
+#include <audio/yas_audio_analysis.h>
+#include <audio/yas_audio_compressed_pcm_buffer.h>
+#include <audio/yas_audio_conversion.h>
 #include <audio/yas_audio_debug.h>
 #include <audio/yas_audio_each_data.h>
 #include <audio/yas_audio_exception.h>
 #include <audio/yas_audio_file.h>
 #include <audio/yas_audio_file_utils.h>
 #include <audio/yas_audio_format.h>
+#include <audio/yas_audio_format_registry.h>
+#include <audio/yas_audio_interleave.h>
 #include <audio/yas_audio_io.h>
+#include <audio/yas_audio_mapped_pcm_buffer.h>
 #include <audio/yas_audio_math.h>
+#include <audio/yas_audio_memory.h>
+#include <audio/yas_audio_mixing.h>
 #include <audio/yas_audio_offline_device.h>
 #include <audio/yas_audio_pcm_buffer.h>
+#include <audio/yas_audio_pcm_buffer_pool.h>
+#include <audio/yas_audio_pcm_buffer_view.h>
+#include <audio/yas_audio_pcm_ring_buffer.h>
 #include <audio/yas_audio_renewable_device.h>
 #include <audio/yas_audio_time.h>
+#include <audio/yas_audio_timeline_clock.h>
+#include <audio/yas_audio_typed_pcm_view.h>
 #include <audio/yas_audio_types.h>
 #include <cpp_utils/yas_cf_utils.h>
 #include <cpp_utils/yas_exception.h>
@@ -47,3 +60,5 @@
 #include <audio/yas_audio_graph_route.h>
 #include <audio/yas_audio_graph_tap.h>
 #include <audio/yas_audio_rendering_graph.h>
+#include <audio/yas_audio_rendering_graph_holder.h>
+#include <audio/yas_audio_rendering_worker_pool.h>
@@ -14,12 +14,18 @@ namespace yas::audio::sample {
 
 namespace yas::audio::sample {
 struct kernel {
-    kernel() : _phase(0), _sine_data(_sineDataMaxCount) {
+    explicit kernel(audio::pcm_buffer_pool_ptr const &buffer_pool) : _phase(0), _buffer_pool(buffer_pool) {
         _through_volume.store(0);
         _sine_frequency.store(1000.0);
         _sine_volume.store(0.0);
     }
 
+    ~kernel() {
+        if (auto const key = _sine_key.load(); key != _no_key) {
+            _buffer_pool->unreserve(key);
+        }
+    }
+
     void set_througn_volume(double value) {
         _through_volume.store(value);
     }
@@ -44,6 +50,17 @@ struct kernel {
         return _sine_volume.load();
     }
 
+    // reserves the mono sine scratch. call it again when the maximum frames per slice changes
+    void prepare(audio::format const &format, uint32_t const frame_capacity) {
+        audio::format const sine_format{{.sample_rate = format.sample_rate(), .channel_count = 1}};
+        auto const key = _buffer_pool->reserve(sine_format, frame_capacity);
+
+        // the render thread may still hold a buffer of the previous key. the pool destroys it once it is released
+        if (auto const prev_key = _sine_key.exchange(key); prev_key != _no_key) {
+            _buffer_pool->unreserve(prev_key);
+        }
+    }
+
     void process(audio::pcm_buffer const * const input_buffer, audio::pcm_buffer * const output_buffer) {
         if (!output_buffer) {
             return;
@@ -56,17 +73,12 @@ struct kernel {
         }
 
         auto const &format = output_buffer->format();
-        if (format.pcm_format() == audio::pcm_format::float32 && format.stride() == 1) {
+        if (format.pcm_format() == audio::pcm_format::float32) {
             if (input_buffer) {
                 if (input_buffer->frame_length() >= frame_length) {
                     output_buffer->copy_from(*input_buffer);
 
-                    float const throughVol = through_volume();
-
-                    auto each = audio::make_each_data<float>(*output_buffer);
-                    while (yas_each_data_next_ch(each)) {
-                        cblas_sscal(frame_length, throughVol, yas_each_data_ptr(each), 1);
-                    }
+                    output_buffer->apply_gain(through_volume());
                 }
             }
 
@@ -75,31 +87,54 @@ struct kernel {
             double const sine_vol = sine_volume();
             double const freq = sine_frequency();
 
-            if (frame_length < _sineDataMaxCount) {
-                _phase = audio::math::fill_sine(&_sine_data[0], frame_length, start_phase,
-                                                freq / sample_rate * audio::math::two_pi);
-
-                auto each = audio::make_each_data<float>(*output_buffer);
-                while (yas_each_data_next_ch(each)) {
-                    cblas_saxpy(frame_length, sine_vol, &_sine_data[0], 1, yas_each_data_ptr(each), 1);
+            // prepare() has to be called before rendering
+            auto const sine_key = _sine_key.load();
+            assert(sine_key != _no_key);
+
+            audio::pcm_buffer *const sine_buffer = sine_key != _no_key ? _buffer_pool->acquire(sine_key) : nullptr;
+
+            if (sine_buffer) {
+                if (frame_length <= sine_buffer->frame_capacity()) {
+                    float *const sine_data = sine_buffer->data_ptr_at_index<float>(0);
+
+                    _phase = audio::math::fill_sine(sine_data, frame_length, start_phase,
+                                                    freq / sample_rate * audio::math::two_pi);
+
+                    if (audio::non_interleaved_pcm_view<float>::is_available(format)) {
+                        audio::non_interleaved_pcm_view<float> const view{*output_buffer};
+                        for (uint32_t ch_idx = 0; ch_idx < view.channel_count(); ++ch_idx) {
+                            cblas_saxpy(frame_length, sine_vol, sine_data, 1, view.data_at_channel(ch_idx), 1);
+                        }
+                    } else {
+                        auto const each = audio::make_inline_each_data<float>(*output_buffer);
+                        int const stride = static_cast<int>(each.stride);
+                        for (std::size_t ch_idx = 0; ch_idx < each.channel_count(); ++ch_idx) {
+                            cblas_saxpy(frame_length, sine_vol, sine_data, 1, each.ptr_at_channel(ch_idx), stride);
+                        }
+                    }
                 }
+
+                _buffer_pool->release(sine_key, sine_buffer);
             }
         }
     }
     
-    static sample::kernel_ptr make_shared() {
-        return std::make_shared<audio::sample::kernel>();
+    static sample::kernel_ptr make_shared(
+        audio::pcm_buffer_pool_ptr const &buffer_pool = audio::pcm_buffer_pool::make_shared()) {
+        return std::make_shared<audio::sample::kernel>(buffer_pool);
     }
 
    private:
-    static uint32_t const _sineDataMaxCount = 4096;
 
     std::atomic<double> _through_volume;
     std::atomic<double> _sine_frequency;
     std::atomic<double> _sine_volume;
 
+    static std::size_t constexpr _no_key = std::numeric_limits<std::size_t>::max();
+
     double _phase;
-    std::vector<float> _sine_data;
+    audio::pcm_buffer_pool_ptr const _buffer_pool;
+    std::atomic<audio::pcm_buffer_pool::key_t> _sine_key{_no_key};
 
     kernel(const kernel &) = delete;
     kernel(kernel &&) = delete;
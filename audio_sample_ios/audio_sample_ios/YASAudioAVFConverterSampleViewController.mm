@@ -27,7 +27,7 @@ struct avf_converter_vc_cpp {
           graph(audio::graph::make_shared()),
           converter(audio::graph_avf_au::make_shared(kAudioUnitType_FormatConverter, kAudioUnitSubType_AUConverter)),
           tap(audio::graph_tap::make_shared()),
-          kernel(audio::sample::kernel::make_shared()) {
+          kernel(audio::sample::kernel::make_shared(this->graph->buffer_pool())) {
     }
 
     std::optional<std::string> setup() {
@@ -49,6 +49,7 @@ struct avf_converter_vc_cpp {
         this->graph->connect(this->converter->node, io->output_node, *output_format);
         this->graph->connect(this->tap->node, this->converter->node, input_format);
 
+        this->kernel->prepare(input_format, io->raw_io()->maximum_frames_per_slice());
         this->kernel->set_sine_volume(0.1);
         this->kernel->set_sine_frequency(1000.0);
 
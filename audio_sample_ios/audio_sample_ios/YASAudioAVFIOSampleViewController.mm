@@ -35,6 +35,10 @@ struct avf_io_vc_cpp {
         auto const io = audio::io::make_shared(this->device);
         auto const kernel = audio::sample::kernel::make_shared();
 
+        if (auto const output_format = this->device->output_format()) {
+            kernel->prepare(*output_format, io->maximum_frames_per_slice());
+        }
+
         this->io = io;
         this->kernel = kernel;
 
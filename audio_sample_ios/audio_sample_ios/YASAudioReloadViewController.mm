@@ -23,7 +23,7 @@ struct reload_vc_cpp {
           device(audio::ios_device::make_renewable_device(this->session)),
           graph(audio::graph::make_shared()),
           tap(audio::graph_tap::make_shared()),
-          kernel(audio::sample::kernel::make_shared()) {
+          kernel(audio::sample::kernel::make_shared(this->graph->buffer_pool())) {
     }
 
     std::optional<std::string> setup() {
@@ -80,6 +80,7 @@ struct reload_vc_cpp {
         if (auto const &io = this->graph->io()) {
             if (auto const &device = io.value()->raw_io()->device()) {
                 if (auto const &format = device.value()->output_format()) {
+                    this->kernel->prepare(format.value(), io.value()->raw_io()->maximum_frames_per_slice());
                     this->graph->connect(this->tap->node, io.value()->output_node, format.value());
                 }
             }
@@ -36,7 +36,7 @@ using sample_kernel_ptr = std::shared_ptr<sample_kernel_t>;
 namespace yas::sample {
 struct device_vc_cpp {
     audio::io_ptr const io = audio::io::make_shared(std::nullopt);
-    sample_kernel_ptr const kernel = std::make_shared<sample_kernel_t>();
+    sample_kernel_ptr const kernel = sample_kernel_t::make_shared();
     std::optional<observing::canceller_ptr> system_canceller = std::nullopt;
     std::optional<observing::canceller_ptr> device_canceller = std::nullopt;
 };
@@ -232,6 +232,10 @@ struct device_vc_cpp {
             self.ioThroughTextColor = (device->input_format() && device->output_format()) ? onColor : offColor;
             self.sineTextColor = device->output_format() ? onColor : offColor;
 
+            if (auto const output_format = device->output_format()) {
+                self->_cpp->kernel->prepare(*output_format, self->_cpp->io->maximum_frames_per_slice());
+            }
+
             return;
         }
     }
@@ -68,10 +68,9 @@ struct sine {
                 uint32_t const frame_length = buffer->frame_length();
 
                 if (frame_length > 0) {
-                    auto each = audio::make_each_data<float>(*buffer);
-                    while (yas_each_data_next_ch(each)) {
-                        next_phase =
-                            audio::math::fill_sine(yas_each_data_ptr(each), frame_length, start_phase, phase_per_frame);
+                    auto const data = audio::make_inline_each_data<float>(*buffer);
+                    for (std::size_t idx = 0; idx < data.ptr_count; ++idx) {
+                        next_phase = audio::math::fill_sine(data.ptrs[idx], frame_length, start_phase, phase_per_frame);
                     }
                     context->phase_on_render = next_phase;
                 }
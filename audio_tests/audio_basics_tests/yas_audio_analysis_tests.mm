@@ -0,0 +1,105 @@
+//
+//  yas_audio_analysis_tests.mm
+//
+
+#import "yas_audio_test_utils.h"
+
+using namespace yas;
+
+@interface yas_audio_analysis_tests : XCTestCase
+
+@end
+
+@implementation yas_audio_analysis_tests
+
+- (void)setUp {
+    [super setUp];
+}
+
+- (void)tearDown {
+    [super tearDown];
+}
+
+- (void)test_is_zero {
+    std::vector<uint8_t> bytes(203);
+
+    XCTAssertTrue(audio::is_zero(bytes.data(), bytes.size()));
+
+    for (std::size_t const idx : {0, 63, 64, 127, 202}) {
+        bytes.at(idx) = 1;
+        XCTAssertFalse(audio::is_zero(bytes.data(), bytes.size()));
+        XCTAssertTrue(audio::is_zero(bytes.data() + idx + 1, bytes.size() - idx - 1));
+        bytes.at(idx) = 0;
+    }
+}
+
+- (void)test_is_silent {
+    for (auto const pcm_format :
+         {audio::pcm_format::float32, audio::pcm_format::float64, audio::pcm_format::int16,
+          audio::pcm_format::fixed824}) {
+        uint32_t const length = 77;
+        std::vector<double> values(length * 2);
+        values.at(151) = 0.5;
+        std::vector<uint8_t> data(length * 2 * sizeof(double));
+        audio::convert(values.data(), 1, audio::pcm_format::float64, data.data(), 1, pcm_format, length * 2);
+
+        XCTAssertTrue(audio::is_silent(data.data(), 1, pcm_format, 151, 0.0));
+        XCTAssertFalse(audio::is_silent(data.data(), 1, pcm_format, 152, 0.0));
+        XCTAssertFalse(audio::is_silent(data.data(), 1, pcm_format, 152, 0.25));
+        XCTAssertTrue(audio::is_silent(data.data(), 1, pcm_format, 152, 0.5));
+        XCTAssertTrue(audio::is_silent(data.data(), 2, pcm_format, length, 0.0));
+    }
+}
+
+- (void)test_peak_and_rms {
+    for (auto const pcm_format :
+         {audio::pcm_format::float32, audio::pcm_format::float64, audio::pcm_format::int16,
+          audio::pcm_format::fixed824, audio::pcm_format::int24, audio::pcm_format::float16}) {
+        uint32_t const length = 37;
+        std::vector<double> values(length * 2);
+        for (uint32_t frame = 0; frame < length; ++frame) {
+            values.at(frame * 2) = (frame % 2) ? 0.25 : -0.25;
+        }
+        values.at(33) = -0.75;
+        std::vector<uint8_t> data(length * 2 * sizeof(double));
+        audio::convert(values.data(), 1, audio::pcm_format::float64, data.data(), 1, pcm_format, length * 2);
+
+        XCTAssertEqual(audio::peak(data.data(), 2, pcm_format, length), 0.25);
+        XCTAssertEqualWithAccuracy(audio::rms(data.data(), 2, pcm_format, length), 0.25, 1e-9);
+        XCTAssertEqual(audio::peak(data.data(), 1, pcm_format, length * 2), 0.75);
+        XCTAssertEqualWithAccuracy(audio::rms(data.data(), 1, pcm_format, length * 2),
+                                   std::sqrt((0.0625 * length + 0.5625) / (length * 2)), 1e-9);
+    }
+}
+
+- (void)test_analysis_failed {
+    float data[1] = {0.0f};
+
+    XCTAssertThrows((void)audio::is_zero(nullptr, 1));
+    XCTAssertThrows((void)audio::is_silent(data, 1, audio::pcm_format::float32, 1, -1.0));
+    XCTAssertThrows((void)audio::is_silent(data, 1, audio::pcm_format::other, 1, 0.0));
+    XCTAssertThrows((void)audio::peak(data, 0, audio::pcm_format::float32, 1));
+    XCTAssertThrows((void)audio::rms(nullptr, 1, audio::pcm_format::float32, 1));
+}
+
+- (void)test_peak_performance {
+    std::vector<float> data(4096);
+
+    [self measureBlock:^{
+        for (uint32_t i = 0; i < 10000; ++i) {
+            (void)audio::peak(data.data(), 1, audio::pcm_format::float32, 4096);
+        }
+    }];
+}
+
+- (void)test_rms_performance {
+    std::vector<float> data(4096);
+
+    [self measureBlock:^{
+        for (uint32_t i = 0; i < 10000; ++i) {
+            (void)audio::rms(data.data(), 1, audio::pcm_format::float32, 4096);
+        }
+    }];
+}
+
+@end
@@ -0,0 +1,205 @@
+//
+//  yas_audio_compressed_pcm_buffer_tests.mm
+//
+
+#import "yas_audio_test_utils.h"
+
+using namespace yas;
+
+namespace yas::test::compressed_pcm_buffer {
+static audio::pcm_buffer make_sine_buffer(audio::pcm_format const pcm_format, bool const interleaved,
+                                          uint32_t const frame_length) {
+    audio::format const format{{.sample_rate = 48000.0,
+                                .channel_count = 2,
+                                .pcm_format = pcm_format,
+                                .interleaved = interleaved}};
+    audio::pcm_buffer buffer{format, frame_length};
+
+    std::vector<float> values(frame_length);
+    for (uint32_t ch_idx = 0; ch_idx < 2; ++ch_idx) {
+        for (uint32_t frame = 0; frame < frame_length; ++frame) {
+            values.at(frame) = std::round(std::sin(frame * 0.01 * (ch_idx + 1)) * 16384.0f) / 32768.0f;
+        }
+        auto const &channel = buffer.audio_buffer_list()->mBuffers[interleaved ? 0 : ch_idx];
+        uint32_t const sample_byte_count = format.sample_byte_count();
+        uint8_t *const data = static_cast<uint8_t *>(channel.mData) + (interleaved ? ch_idx * sample_byte_count : 0);
+        audio::convert(values.data(), 1, audio::pcm_format::float32, data, format.stride(), pcm_format, frame_length);
+    }
+
+    return buffer;
+}
+
+static bool is_equal_frames(audio::pcm_buffer const &buffer1, uint32_t const begin_frame1,
+                            audio::pcm_buffer const &buffer2, uint32_t const begin_frame2, uint32_t const length) {
+    for (uint32_t ch_idx = 0; ch_idx < buffer1.format().channel_count(); ++ch_idx) {
+        for (uint32_t frame = 0; frame < length; ++frame) {
+            if (!test::is_equal_data(test::data_ptr_from_buffer(buffer1, ch_idx, begin_frame1 + frame),
+                                     test::data_ptr_from_buffer(buffer2, ch_idx, begin_frame2 + frame),
+                                     buffer1.format().sample_byte_count())) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+}
+
+@interface yas_audio_compressed_pcm_buffer_tests : XCTestCase
+
+@end
+
+@implementation yas_audio_compressed_pcm_buffer_tests
+
+- (void)setUp {
+    [super setUp];
+}
+
+- (void)tearDown {
+    [super tearDown];
+}
+
+- (void)test_round_trip {
+    uint32_t const frame_length = 10000;
+
+    for (auto const pcm_format :
+         {audio::pcm_format::float32, audio::pcm_format::float64, audio::pcm_format::int16,
+          audio::pcm_format::fixed824, audio::pcm_format::int24, audio::pcm_format::float16}) {
+        for (bool const interleaved : {false, true}) {
+            auto const src_buffer =
+                test::compressed_pcm_buffer::make_sine_buffer(pcm_format, interleaved, frame_length);
+            auto const compressed = audio::compressed_pcm_buffer::make_shared(src_buffer, 1024);
+
+            XCTAssertEqual(compressed->frame_length(), frame_length);
+            XCTAssertEqual(compressed->block_length(), 1024);
+            XCTAssertEqual(compressed->block_count(), 10);
+            XCTAssertLessThan(compressed->compressed_byte_count(), compressed->uncompressed_byte_count());
+
+            audio::pcm_buffer dst_buffer{src_buffer.format(), frame_length};
+            dst_buffer.set_frame_length(0);
+
+            auto const result = compressed->decode(dst_buffer);
+
+            XCTAssertTrue(result);
+            XCTAssertEqual(result.value(), frame_length);
+            XCTAssertEqual(dst_buffer.frame_length(), frame_length);
+            XCTAssertTrue(test::is_equal_buffer_flexibly(src_buffer, dst_buffer));
+        }
+    }
+}
+
+- (void)test_compression_ratio {
+    auto const src_buffer = test::compressed_pcm_buffer::make_sine_buffer(audio::pcm_format::float32, false, 48000);
+    auto const compressed = audio::compressed_pcm_buffer::make_shared(src_buffer);
+
+    XCTAssertLessThan(compressed->compressed_byte_count() * 4, compressed->uncompressed_byte_count());
+}
+
+- (void)test_lossless_with_arbitrary_values {
+    audio::format const format{{.sample_rate = 48000.0, .channel_count = 1}};
+    audio::pcm_buffer src_buffer{format, 1000};
+
+    float *const src_ptr = src_buffer.data_ptr_at_index<float>(0);
+    for (uint32_t frame = 0; frame < 1000; ++frame) {
+        src_ptr[frame] = std::sin(static_cast<float>(frame) * 0.123f) * 0.001f;
+    }
+    src_ptr[1] = -0.0f;
+    src_ptr[2] = std::numeric_limits<float>::infinity();
+    src_ptr[3] = std::numeric_limits<float>::denorm_min();
+
+    auto const compressed = audio::compressed_pcm_buffer::make_shared(src_buffer, 256);
+    audio::pcm_buffer dst_buffer{format, 1000};
+
+    XCTAssertTrue(compressed->decode(dst_buffer));
+    XCTAssertTrue(test::is_equal_buffer_flexibly(src_buffer, dst_buffer));
+}
+
+- (void)test_decode_range {
+    uint32_t const frame_length = 5000;
+    auto const src_buffer =
+        test::compressed_pcm_buffer::make_sine_buffer(audio::pcm_format::int16, true, frame_length);
+    auto const compressed = audio::compressed_pcm_buffer::make_shared(src_buffer, 512);
+
+    audio::format const dst_format{
+        {.sample_rate = 48000.0, .channel_count = 2, .pcm_format = audio::pcm_format::int16, .interleaved = false}};
+    audio::pcm_buffer dst_buffer{dst_format, 1000};
+
+    auto const result =
+        compressed->decode(dst_buffer, {.from_begin_frame = 1500, .to_begin_frame = 100, .length = 700});
+
+    XCTAssertTrue(result);
+    XCTAssertEqual(result.value(), 700);
+    XCTAssertTrue(test::compressed_pcm_buffer::is_equal_frames(src_buffer, 1500, dst_buffer, 100, 700));
+}
+
+- (void)test_decode_block {
+    uint32_t const frame_length = 1100;
+    auto const src_buffer =
+        test::compressed_pcm_buffer::make_sine_buffer(audio::pcm_format::int24, false, frame_length);
+    auto const compressed = audio::compressed_pcm_buffer::make_shared(src_buffer, 512);
+    audio::pcm_buffer dst_buffer{src_buffer.format(), 512};
+
+    XCTAssertEqual(compressed->block_count(), 3);
+
+    auto result = compressed->decode_block(1, dst_buffer);
+
+    XCTAssertTrue(result);
+    XCTAssertEqual(result.value(), 512);
+    XCTAssertTrue(test::compressed_pcm_buffer::is_equal_frames(src_buffer, 512, dst_buffer, 0, 512));
+
+    result = compressed->decode_block(2, dst_buffer);
+
+    XCTAssertTrue(result);
+    XCTAssertEqual(result.value(), 76);
+    XCTAssertTrue(test::compressed_pcm_buffer::is_equal_frames(src_buffer, 1024, dst_buffer, 0, 76));
+
+    result = compressed->decode_block(3, dst_buffer);
+
+    XCTAssertFalse(result);
+    XCTAssertEqual(result.error(), audio::pcm_buffer::copy_error_t::out_of_range_frame);
+}
+
+- (void)test_decode_failed {
+    auto const src_buffer = test::compressed_pcm_buffer::make_sine_buffer(audio::pcm_format::int16, false, 100);
+    auto const compressed = audio::compressed_pcm_buffer::make_shared(src_buffer, 64);
+
+    audio::pcm_buffer float_buffer{audio::format{{.sample_rate = 48000.0, .channel_count = 2}}, 100};
+    auto const format_result = compressed->decode(float_buffer);
+
+    XCTAssertFalse(format_result);
+    XCTAssertEqual(format_result.error(), audio::pcm_buffer::copy_error_t::invalid_format);
+
+    audio::pcm_buffer short_buffer{src_buffer.format(), 50};
+    auto const range_result = compressed->decode(short_buffer);
+
+    XCTAssertFalse(range_result);
+    XCTAssertEqual(range_result.error(), audio::pcm_buffer::copy_error_t::out_of_range_frame);
+
+    audio::pcm_buffer partial_buffer{src_buffer.format(), 100};
+    partial_buffer.set_frame_length(50);
+    auto const partial_result = compressed->decode(partial_buffer, {.to_begin_frame = 40, .length = 20});
+
+    XCTAssertFalse(partial_result);
+    XCTAssertEqual(partial_result.error(), audio::pcm_buffer::copy_error_t::out_of_range_frame);
+
+    auto const overflow_result =
+        compressed->decode(partial_buffer, {.from_begin_frame = 10, .length = std::numeric_limits<uint32_t>::max()});
+
+    XCTAssertFalse(overflow_result);
+    XCTAssertEqual(overflow_result.error(), audio::pcm_buffer::copy_error_t::out_of_range_frame);
+
+    XCTAssertThrows(audio::compressed_pcm_buffer::make_shared(src_buffer, 0));
+}
+
+- (void)test_decode_block_performance {
+    auto const src_buffer = test::compressed_pcm_buffer::make_sine_buffer(audio::pcm_format::float32, false, 48000);
+    auto const compressed = audio::compressed_pcm_buffer::make_shared(src_buffer, 512);
+    audio::pcm_buffer dst_buffer{src_buffer.format(), 512};
+
+    [self measureBlock:^{
+        for (uint32_t i = 0; i < 10000; ++i) {
+            (void)compressed->decode_block(i % compressed->block_count(), dst_buffer);
+        }
+    }];
+}
+
+@end
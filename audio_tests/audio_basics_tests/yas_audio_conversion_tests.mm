@@ -0,0 +1,270 @@
+//
+//  yas_audio_conversion_tests.mm
+//
+
+#import "yas_audio_test_utils.h"
+
+using namespace yas;
+
+@interface yas_audio_conversion_tests : XCTestCase
+
+- (void)test_convert_int24_to_float32_performance {
+    uint32_t const length = 512;
+    std::vector<audio::int24_t> from(length);
+    std::vector<float> to(length);
+
+    [self measureBlock:^{
+        for (uint32_t i = 0; i < 10000; ++i) {
+            audio::convert(from.data(), 1, audio::pcm_format::int24, to.data(), 1, audio::pcm_format::float32, length);
+        }
+    }];
+}
+
+- (void)test_convert_float32_to_float16_performance {
+    uint32_t const length = 512;
+    std::vector<float> from(length);
+    std::vector<audio::float16_t> to(length);
+
+    [self measureBlock:^{
+        for (uint32_t i = 0; i < 10000; ++i) {
+            audio::convert(from.data(), 1, audio::pcm_format::float32, to.data(), 1, audio::pcm_format::float16,
+                           length);
+        }
+    }];
+}
+
+@end
+
+@implementation yas_audio_conversion_tests
+
+- (void)setUp {
+    [super setUp];
+}
+
+- (void)tearDown {
+    [super tearDown];
+}
+
+- (void)test_convert_float32_to_int16 {
+    float const from[6] = {0.0f, 0.5f, -0.5f, 1.0f, -1.0f, 2.0f};
+    int16_t to[6] = {0};
+
+    audio::convert(from, 1, audio::pcm_format::float32, to, 1, audio::pcm_format::int16, 6);
+
+    XCTAssertEqual(to[0], 0);
+    XCTAssertEqual(to[1], 16384);
+    XCTAssertEqual(to[2], -16384);
+    XCTAssertEqual(to[3], 32767);
+    XCTAssertEqual(to[4], -32768);
+    XCTAssertEqual(to[5], 32767);
+}
+
+- (void)test_convert_int16_to_float32 {
+    int16_t const from[4] = {0, 16384, -32768, 32767};
+    float to[4] = {0};
+
+    audio::convert(from, 1, audio::pcm_format::int16, to, 1, audio::pcm_format::float32, 4);
+
+    XCTAssertEqual(to[0], 0.0f);
+    XCTAssertEqual(to[1], 0.5f);
+    XCTAssertEqual(to[2], -1.0f);
+    XCTAssertEqual(to[3], 32767.0f / 32768.0f);
+}
+
+- (void)test_convert_fixed824 {
+    float const from[3] = {0.25f, -1.0f, 200.0f};
+    int32_t fixed[3] = {0};
+    double to[3] = {0};
+
+    audio::convert(from, 1, audio::pcm_format::float32, fixed, 1, audio::pcm_format::fixed824, 3);
+
+    XCTAssertEqual(fixed[0], 1 << 22);
+    XCTAssertEqual(fixed[1], -(1 << 24));
+    XCTAssertEqual(fixed[2], INT32_MAX);
+
+    audio::convert(fixed, 1, audio::pcm_format::fixed824, to, 1, audio::pcm_format::float64, 2);
+
+    XCTAssertEqual(to[0], 0.25);
+    XCTAssertEqual(to[1], -1.0);
+}
+
+- (void)test_convert_int24 {
+    float const from[5] = {0.5f, -1.0f, 2.0f, -0.25f, 0.0f};
+    audio::int24_t int24[5];
+    float to[5] = {0.0f};
+
+    audio::convert(from, 1, audio::pcm_format::float32, int24, 1, audio::pcm_format::int24, 5);
+
+    XCTAssertEqual(audio::to_int32(int24[0]), 1 << 22);
+    XCTAssertEqual(audio::to_int32(int24[1]), -(1 << 23));
+    XCTAssertEqual(audio::to_int32(int24[2]), (1 << 23) - 1);
+    XCTAssertEqual(audio::to_int32(int24[3]), -(1 << 21));
+    XCTAssertEqual(audio::to_int32(int24[4]), 0);
+
+    audio::convert(int24, 1, audio::pcm_format::int24, to, 1, audio::pcm_format::float32, 5);
+
+    XCTAssertEqual(to[0], 0.5f);
+    XCTAssertEqual(to[1], -1.0f);
+    XCTAssertEqual(to[2], 8388607.0f / 8388608.0f);
+    XCTAssertEqual(to[3], -0.25f);
+    XCTAssertEqual(to[4], 0.0f);
+}
+
+- (void)test_int24_bytes {
+    audio::int24_t const value = audio::to_int24(-2);
+
+    XCTAssertEqual(value.bytes[0], 0xfe);
+    XCTAssertEqual(value.bytes[1], 0xff);
+    XCTAssertEqual(value.bytes[2], 0xff);
+    XCTAssertEqual(audio::to_int32(value), -2);
+    XCTAssertEqual(audio::to_int32(audio::to_int24(0x123456)), 0x123456);
+}
+
+- (void)test_convert_float16 {
+    float const from[6] = {1.0f, -2.0f, 65504.0f, 100000.0f, 0.0f, 0.1f};
+    audio::float16_t float16[6];
+    float to[6] = {0.0f};
+
+    audio::convert(from, 1, audio::pcm_format::float32, float16, 1, audio::pcm_format::float16, 6);
+
+    XCTAssertEqual(float16[0].bits, 0x3c00);
+    XCTAssertEqual(float16[1].bits, 0xc000);
+    XCTAssertEqual(float16[2].bits, 0x7bff);
+    XCTAssertEqual(float16[3].bits, 0x7c00);
+    XCTAssertEqual(float16[4].bits, 0x0000);
+    XCTAssertEqual(float16[5].bits, 0x2e66);
+
+    audio::convert(float16, 1, audio::pcm_format::float16, to, 1, audio::pcm_format::float32, 6);
+
+    XCTAssertEqual(to[0], 1.0f);
+    XCTAssertEqual(to[1], -2.0f);
+    XCTAssertEqual(to[2], 65504.0f);
+    XCTAssertTrue(std::isinf(to[3]));
+    XCTAssertEqual(to[4], 0.0f);
+    XCTAssertEqual(to[5], 0.0999755859375f);
+}
+
+- (void)test_convert_float16_round_trip {
+    uint32_t const length = 0x7c00;
+    std::vector<audio::float16_t> from(length);
+    for (uint32_t idx = 0; idx < length; ++idx) {
+        from.at(idx).bits = static_cast<uint16_t>(idx);
+    }
+    std::vector<float> mid(length);
+    std::vector<audio::float16_t> to(length);
+
+    audio::convert(from.data(), 1, audio::pcm_format::float16, mid.data(), 1, audio::pcm_format::float32, length);
+    audio::convert(mid.data(), 1, audio::pcm_format::float32, to.data(), 1, audio::pcm_format::float16, length);
+
+    for (uint32_t idx = 0; idx < length; ++idx) {
+        XCTAssertEqual(to.at(idx).bits, from.at(idx).bits);
+        XCTAssertEqual(audio::to_float32(from.at(idx)), mid.at(idx));
+    }
+}
+
+- (void)test_convert_round_trip {
+    uint32_t const length = 37;
+    std::vector<int16_t> from(length);
+    for (uint32_t frame = 0; frame < length; ++frame) {
+        from.at(frame) = static_cast<int16_t>((static_cast<int32_t>(frame) - 18) * 1000);
+    }
+
+    for (auto const pcm_format :
+         {audio::pcm_format::float32, audio::pcm_format::float64, audio::pcm_format::fixed824,
+          audio::pcm_format::int24}) {
+        std::vector<double> mid(length * 2);
+        std::vector<int16_t> to(length);
+
+        audio::convert(from.data(), 1, audio::pcm_format::int16, mid.data(), 2, pcm_format, length);
+        audio::convert(mid.data(), 2, pcm_format, to.data(), 1, audio::pcm_format::int16, length);
+
+        XCTAssertTrue(to == from);
+    }
+}
+
+- (void)test_convert_with_stride {
+    float const from[8] = {0.5f, 1.0f, -0.5f, 1.0f, 0.25f, 1.0f, -0.25f, 1.0f};
+    int16_t to[4] = {0};
+
+    audio::convert(from, 2, audio::pcm_format::float32, to, 1, audio::pcm_format::int16, 4);
+
+    XCTAssertEqual(to[0], 16384);
+    XCTAssertEqual(to[1], -16384);
+    XCTAssertEqual(to[2], 8192);
+    XCTAssertEqual(to[3], -8192);
+}
+
+- (void)test_convert_with_dither {
+    uint32_t const length = 4096;
+    std::vector<float> from(length, 0.25f / 32768.0f);
+    std::vector<int16_t> to(length);
+
+    audio::convert(from.data(), 1, audio::pcm_format::float32, to.data(), 1, audio::pcm_format::int16, length, true);
+
+    double sum = 0.0;
+    for (int16_t const value : to) {
+        XCTAssertTrue(-1 <= value && value <= 1);
+        sum += value;
+    }
+
+    XCTAssertEqualWithAccuracy(sum / length, 0.25, 0.05);
+}
+
+- (void)test_convert_failed {
+    float from[1] = {0.0f};
+    float to[1] = {0.0f};
+
+    XCTAssertThrows(audio::convert(from, 1, audio::pcm_format::other, to, 1, audio::pcm_format::float32, 1));
+    XCTAssertThrows(audio::convert(from, 1, audio::pcm_format::float32, to, 1, audio::pcm_format::other, 1));
+}
+
+- (void)test_convert_int16_to_float32_performance {
+    uint32_t const length = 512;
+    std::vector<int16_t> from(length);
+    std::vector<float> to(length);
+
+    [self measureBlock:^{
+        for (uint32_t i = 0; i < 10000; ++i) {
+            audio::convert(from.data(), 1, audio::pcm_format::int16, to.data(), 1, audio::pcm_format::float32, length);
+        }
+    }];
+}
+
+- (void)test_convert_float32_to_int16_performance {
+    uint32_t const length = 512;
+    std::vector<float> from(length);
+    std::vector<int16_t> to(length);
+
+    [self measureBlock:^{
+        for (uint32_t i = 0; i < 10000; ++i) {
+            audio::convert(from.data(), 1, audio::pcm_format::float32, to.data(), 1, audio::pcm_format::int16, length);
+        }
+    }];
+}
+
+- (void)test_convert_int24_to_float32_performance {
+    uint32_t const length = 512;
+    std::vector<audio::int24_t> from(length);
+    std::vector<float> to(length);
+
+    [self measureBlock:^{
+        for (uint32_t i = 0; i < 10000; ++i) {
+            audio::convert(from.data(), 1, audio::pcm_format::int24, to.data(), 1, audio::pcm_format::float32, length);
+        }
+    }];
+}
+
+- (void)test_convert_float32_to_float16_performance {
+    uint32_t const length = 512;
+    std::vector<float> from(length);
+    std::vector<audio::float16_t> to(length);
+
+    [self measureBlock:^{
+        for (uint32_t i = 0; i < 10000; ++i) {
+            audio::convert(from.data(), 1, audio::pcm_format::float32, to.data(), 1, audio::pcm_format::float16,
+                           length);
+        }
+    }];
+}
+
+@end
@@ -66,4 +66,94 @@ using namespace yas;
     XCTAssertEqual(ch1_ptr[3], 7);
 }
 
+- (void)test_inline_each_data {
+    audio::format format(
+        {.sample_rate = 48000.0, .channel_count = 2, .pcm_format = audio::pcm_format::int16, .interleaved = false});
+    audio::pcm_buffer buffer(format, 4);
+
+    auto const data = audio::make_inline_each_data<int16_t>(buffer);
+
+    XCTAssertEqual(data.ptr_count, 2);
+    XCTAssertEqual(data.stride, 1);
+    XCTAssertEqual(data.frame_length, 4);
+    XCTAssertEqual(data.channel_count(), 2);
+    XCTAssertEqual(data.ptrs[0], buffer.data_ptr_at_channel<int16_t>(0));
+    XCTAssertEqual(data.ptr_at_channel(1), buffer.data_ptr_at_channel<int16_t>(1));
+
+    audio::pcm_buffer const &const_buffer = buffer;
+    auto const const_data = audio::make_inline_each_data<int16_t>(const_buffer);
+
+    XCTAssertEqual(const_data.ptrs[1], const_buffer.data_ptr_at_channel<int16_t>(1));
+}
+
+- (void)test_each_block_non_interleaved {
+    audio::format format(
+        {.sample_rate = 48000.0, .channel_count = 2, .pcm_format = audio::pcm_format::float32, .interleaved = false});
+    audio::pcm_buffer buffer(format, 10);
+
+    std::vector<std::pair<std::size_t, std::size_t>> indices;
+
+    auto each = audio::make_each_block<float>(buffer, 4);
+    while (each.next()) {
+        indices.emplace_back(each.frame_index(), each.channel_index());
+
+        XCTAssertEqual(each.stride(), 1);
+        XCTAssertEqual(each.length(), each.frame_index() == 8 ? 2 : 4);
+
+        for (std::size_t idx = 0; idx < each.length(); ++idx) {
+            each.ptr()[idx] = each.frame_index() + idx + 100 * each.channel_index();
+        }
+    }
+
+    XCTAssertEqual(indices.size(), 6);
+    XCTAssertTrue((indices.at(0) == std::pair<std::size_t, std::size_t>{0, 0}));
+    XCTAssertTrue((indices.at(1) == std::pair<std::size_t, std::size_t>{0, 1}));
+    XCTAssertTrue((indices.at(5) == std::pair<std::size_t, std::size_t>{8, 1}));
+
+    for (uint32_t frame = 0; frame < 10; ++frame) {
+        XCTAssertEqual(buffer.data_ptr_at_channel<float>(0)[frame], frame);
+        XCTAssertEqual(buffer.data_ptr_at_channel<float>(1)[frame], frame + 100);
+    }
+}
+
+- (void)test_each_block_interleaved {
+    audio::format format(
+        {.sample_rate = 48000.0, .channel_count = 3, .pcm_format = audio::pcm_format::int16, .interleaved = true});
+    audio::pcm_buffer buffer(format, 5);
+
+    std::size_t count = 0;
+
+    auto each = audio::make_each_block<int16_t>(buffer, 2);
+    while (each.next()) {
+        ++count;
+
+        XCTAssertEqual(each.stride(), 3);
+
+        for (std::size_t idx = 0; idx < each.length(); ++idx) {
+            each.ptr()[idx * each.stride()] = each.frame_index() + idx + 10 * each.channel_index();
+        }
+    }
+
+    XCTAssertEqual(count, 9);
+
+    auto const ptr = buffer.data_ptr_at_index<int16_t>(0);
+
+    for (uint32_t frame = 0; frame < 5; ++frame) {
+        for (uint32_t ch_idx = 0; ch_idx < 3; ++ch_idx) {
+            XCTAssertEqual(ptr[frame * 3 + ch_idx], frame + 10 * ch_idx);
+        }
+    }
+}
+
+- (void)test_each_block_empty {
+    audio::format format({.sample_rate = 48000.0, .channel_count = 1});
+    audio::pcm_buffer buffer(format, 4);
+    buffer.set_frame_length(0);
+
+    auto each = audio::make_each_block<float>(buffer, 4);
+
+    XCTAssertFalse(each.next());
+    XCTAssertThrows(audio::make_each_block<float>(buffer, 0));
+}
+
 @end
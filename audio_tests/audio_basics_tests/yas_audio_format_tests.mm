@@ -131,6 +131,27 @@ using namespace yas;
     XCTAssertTrue(is_equal(format.stream_description(), asbd));
 }
 
+- (void)test_create_format_int24_and_float16 {
+    auto const int24_format = audio::format(
+        {.sample_rate = 48000.0, .channel_count = 2, .pcm_format = audio::pcm_format::int24, .interleaved = true});
+
+    XCTAssert(int24_format.pcm_format() == audio::pcm_format::int24);
+    XCTAssertEqual(int24_format.sample_byte_count(), 3);
+    XCTAssertEqual(int24_format.frame_byte_count(), 6);
+    XCTAssertEqual(int24_format.stream_description().mBitsPerChannel, 24);
+    XCTAssertTrue(int24_format.stream_description().mFormatFlags & kAudioFormatFlagIsSignedInteger);
+
+    auto const float16_format = audio::format(
+        {.sample_rate = 48000.0, .channel_count = 2, .pcm_format = audio::pcm_format::float16, .interleaved = false});
+
+    XCTAssert(float16_format.pcm_format() == audio::pcm_format::float16);
+    XCTAssertEqual(float16_format.sample_byte_count(), 2);
+    XCTAssertEqual(float16_format.frame_byte_count(), 2);
+    XCTAssertEqual(float16_format.stream_description().mBitsPerChannel, 16);
+    XCTAssertTrue(float16_format.stream_description().mFormatFlags & kAudioFormatFlagIsFloat);
+    XCTAssert(float16_format != int24_format);
+}
+
 - (void)test_create_format_with_streadm_description {
     double const sampleRate = 2348739.1;
     uint32_t const channelCount = 6;
@@ -174,6 +195,44 @@ using namespace yas;
     XCTAssert(audio_format1 == audio_format2);
 }
 
+- (void)test_format_id {
+    auto const format1 = audio::format({.sample_rate = 44100.0, .channel_count = 2});
+    auto const format2 = audio::format({.sample_rate = 44100.0, .channel_count = 2});
+    auto const format3 = audio::format({.sample_rate = 48000.0, .channel_count = 2});
+    auto const format4 = audio::format(format1.stream_description());
+
+    XCTAssertEqual(format1.id(), format2.id());
+    XCTAssertEqual(format1.id(), format4.id());
+    XCTAssertNotEqual(format1.id(), format3.id());
+    XCTAssert(format1 != format3);
+}
+
+- (void)test_format_registry {
+    std::size_t const count = audio::format_registry::count();
+
+    auto const format1 = audio::format({.sample_rate = 12345.0, .channel_count = 7});
+
+    XCTAssertEqual(audio::format_registry::count(), count + 1);
+
+    auto const format2 = audio::format({.sample_rate = 12345.0, .channel_count = 7});
+
+    XCTAssertEqual(audio::format_registry::count(), count + 1);
+    XCTAssertEqual(audio::format_registry::intern(format1.stream_description()), format2.id());
+}
+
+- (void)test_equal_formats_performance {
+    auto const format1 = audio::format({.sample_rate = 44100.0, .channel_count = 2});
+    auto const format2 = audio::format({.sample_rate = 44100.0, .channel_count = 2});
+
+    [self measureBlock:^{
+        std::size_t count = 0;
+        for (uint32_t i = 0; i < 10000; ++i) {
+            count += (format1 == format2) ? 1 : 0;
+        }
+        XCTAssertEqual(count, 10000);
+    }];
+}
+
 - (void)test_create_format_with_settings {
     double const sampleRate = 44100.0;
 
@@ -0,0 +1,85 @@
+//
+//  yas_audio_interleave_tests.mm
+//
+
+#import "yas_audio_test_utils.h"
+
+using namespace yas;
+
+@interface yas_audio_interleave_tests : XCTestCase
+
+@end
+
+@implementation yas_audio_interleave_tests
+
+- (void)setUp {
+    [super setUp];
+}
+
+- (void)tearDown {
+    [super tearDown];
+}
+
+- (void)test_deinterleave_and_interleave {
+    uint32_t const length = 37;
+
+    for (uint32_t const sample_byte_count : {2, 4, 8}) {
+        for (uint32_t ch_count = 1; ch_count <= 9; ++ch_count) {
+            std::vector<uint8_t> interleaved(length * ch_count * sample_byte_count);
+            for (uint32_t idx = 0; idx < interleaved.size(); ++idx) {
+                interleaved.at(idx) = static_cast<uint8_t>(idx * 7 + 1);
+            }
+
+            std::vector<std::vector<uint8_t>> planes(ch_count, std::vector<uint8_t>(length * sample_byte_count));
+            std::vector<void *> plane_ptrs;
+            for (auto &plane : planes) {
+                plane_ptrs.push_back(plane.data());
+            }
+
+            audio::deinterleave(interleaved.data(), plane_ptrs.data(), ch_count, length, sample_byte_count);
+
+            for (uint32_t ch_idx = 0; ch_idx < ch_count; ++ch_idx) {
+                for (uint32_t frame = 0; frame < length; ++frame) {
+                    uint8_t const *const from_ptr = &interleaved.at((frame * ch_count + ch_idx) * sample_byte_count);
+                    uint8_t const *const to_ptr = &planes.at(ch_idx).at(frame * sample_byte_count);
+                    XCTAssertEqual(memcmp(from_ptr, to_ptr, sample_byte_count), 0);
+                }
+            }
+
+            std::vector<uint8_t> reinterleaved(interleaved.size());
+            std::vector<void const *> const_plane_ptrs(plane_ptrs.begin(), plane_ptrs.end());
+
+            audio::interleave(const_plane_ptrs.data(), reinterleaved.data(), ch_count, length, sample_byte_count);
+
+            XCTAssertTrue(reinterleaved == interleaved);
+        }
+    }
+}
+
+- (void)test_deinterleave_failed {
+    float from[4];
+    float to[4];
+    void *to_ptrs[1] = {to};
+
+    XCTAssertThrows(audio::deinterleave(nullptr, to_ptrs, 1, 4, 4));
+    XCTAssertThrows(audio::deinterleave(from, nullptr, 1, 4, 4));
+    XCTAssertThrows(audio::deinterleave(from, to_ptrs, 0, 4, 4));
+    XCTAssertThrows(audio::deinterleave(from, to_ptrs, 1, 4, 0));
+}
+
+- (void)test_deinterleave_performance {
+    uint32_t const ch_count = 2;
+    uint32_t const length = 512;
+
+    std::vector<float> interleaved(length * ch_count);
+    std::vector<std::vector<float>> planes(ch_count, std::vector<float>(length));
+    void *plane_ptrs[ch_count] = {planes.at(0).data(), planes.at(1).data()};
+
+    [self measureBlock:^{
+        for (uint32_t i = 0; i < 10000; ++i) {
+            audio::deinterleave(interleaved.data(), plane_ptrs, ch_count, length, sizeof(float));
+        }
+    }];
+}
+
+@end
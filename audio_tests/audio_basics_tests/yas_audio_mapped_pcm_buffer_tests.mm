@@ -0,0 +1,164 @@
+//
+//  yas_audio_mapped_pcm_buffer_tests.mm
+//
+
+#import <cpp_utils/yas_file_manager.h>
+#import <cpp_utils/yas_system_path_utils.h>
+#import <fstream>
+#import "yas_audio_test_utils.h"
+
+using namespace yas;
+
+namespace yas::test::mapped_pcm_buffer {
+static yas::url temporary_test_dir_url() {
+    return system_path_utils::directory_url(system_path_utils::dir::temporary)
+        .appending("yas_audio_mapped_pcm_buffer_test_files");
+}
+
+static void setup_directory() {
+    auto path = temporary_test_dir_url().path();
+
+    if (auto result = file_manager::remove_contents_in_directory(path); result.is_error()) {
+        throw std::runtime_error("remove_files failed");
+    }
+
+    if (auto result = file_manager::create_directory_if_not_exists(path); result.is_error()) {
+        throw std::runtime_error("create_directory_if_not_exists failed");
+    }
+}
+
+static yas::url write_int16_file(std::string const &file_name, uint64_t const byte_offset,
+                                 uint32_t const sample_count) {
+    auto const file_url = temporary_test_dir_url().appending(file_name);
+
+    std::ofstream stream(file_url.path(), std::ios::binary);
+    std::vector<char> const header(byte_offset, 0);
+    stream.write(header.data(), header.size());
+
+    for (uint32_t idx = 0; idx < sample_count; ++idx) {
+        int16_t const value = static_cast<int16_t>(idx);
+        stream.write(reinterpret_cast<char const *>(&value), sizeof(int16_t));
+    }
+
+    return file_url;
+}
+}
+
+@interface yas_audio_mapped_pcm_buffer_tests : XCTestCase
+
+@end
+
+@implementation yas_audio_mapped_pcm_buffer_tests
+
+- (void)setUp {
+    [super setUp];
+
+    test::mapped_pcm_buffer::setup_directory();
+}
+
+- (void)tearDown {
+    [super tearDown];
+}
+
+- (void)test_make_interleaved {
+    uint32_t const frame_length = 3000;
+    uint64_t const byte_offset = 100;
+    auto const file_url = test::mapped_pcm_buffer::write_int16_file("interleaved.raw", byte_offset, frame_length * 2);
+
+    audio::format const format{{.sample_rate = 48000.0,
+                                .channel_count = 2,
+                                .pcm_format = audio::pcm_format::int16,
+                                .interleaved = true}};
+
+    auto const result = audio::mapped_pcm_buffer::make_shared({.file_url = file_url,
+                                                               .format = format,
+                                                               .byte_offset = byte_offset,
+                                                               .advice = audio::mapped_pcm_buffer::advice::sequential});
+
+    XCTAssertTrue(result);
+
+    auto const &buffer = result.value()->buffer();
+
+    XCTAssertTrue(buffer.format() == format);
+    XCTAssertEqual(buffer.frame_length(), frame_length);
+    XCTAssertEqual(buffer.frame_capacity(), frame_length);
+
+    int16_t const *const data = buffer.data_ptr_at_index<int16_t>(0);
+
+    for (uint32_t idx = 0; idx < frame_length * 2; ++idx) {
+        XCTAssertEqual(data[idx], static_cast<int16_t>(idx));
+    }
+}
+
+- (void)test_make_non_interleaved {
+    uint32_t const frame_length = 1000;
+    auto const file_url = test::mapped_pcm_buffer::write_int16_file("non_interleaved.raw", 0, frame_length * 2);
+
+    audio::format const format{{.sample_rate = 48000.0,
+                                .channel_count = 2,
+                                .pcm_format = audio::pcm_format::int16,
+                                .interleaved = false}};
+
+    auto const result = audio::mapped_pcm_buffer::make_shared({.file_url = file_url, .format = format});
+
+    XCTAssertTrue(result);
+
+    auto const &buffer = result.value()->buffer();
+
+    XCTAssertEqual(buffer.frame_length(), frame_length);
+    XCTAssertEqual(buffer.data_ptr_at_channel<int16_t>(0)[0], 0);
+    XCTAssertEqual(buffer.data_ptr_at_channel<int16_t>(1)[0], static_cast<int16_t>(frame_length));
+}
+
+- (void)test_make_with_frame_length {
+    auto const file_url = test::mapped_pcm_buffer::write_int16_file("frame_length.raw", 0, 512);
+
+    audio::format const format{{.sample_rate = 48000.0, .channel_count = 1, .pcm_format = audio::pcm_format::int16}};
+
+    auto const result =
+        audio::mapped_pcm_buffer::make_shared({.file_url = file_url, .format = format, .frame_length = 256});
+
+    XCTAssertTrue(result);
+    XCTAssertEqual(result.value()->buffer().frame_length(), 256);
+}
+
+- (void)test_advise {
+    auto const file_url = test::mapped_pcm_buffer::write_int16_file("advise.raw", 0, 512);
+
+    audio::format const format{{.sample_rate = 48000.0, .channel_count = 1, .pcm_format = audio::pcm_format::int16}};
+
+    auto const mapped = audio::mapped_pcm_buffer::make_shared({.file_url = file_url, .format = format}).value();
+
+    XCTAssertNoThrow(mapped->advise(audio::mapped_pcm_buffer::advice::will_need, 128, 256));
+    XCTAssertNoThrow(mapped->advise(audio::mapped_pcm_buffer::advice::dont_need, 0, 512));
+    XCTAssertThrows(mapped->advise(audio::mapped_pcm_buffer::advice::random, 511, 2));
+}
+
+- (void)test_make_failed {
+    auto const file_url = test::mapped_pcm_buffer::write_int16_file("failed.raw", 0, 512);
+
+    audio::format const format{{.sample_rate = 48000.0, .channel_count = 1, .pcm_format = audio::pcm_format::int16}};
+
+    auto result = audio::mapped_pcm_buffer::make_shared({.file_url = file_url, .format = format, .frame_length = 513});
+    XCTAssertFalse(result);
+    XCTAssertEqual(result.error(), audio::mapped_pcm_buffer::open_error_t::out_of_range);
+
+    result = audio::mapped_pcm_buffer::make_shared({.file_url = file_url, .format = format, .byte_offset = 1025});
+    XCTAssertFalse(result);
+    XCTAssertEqual(result.error(), audio::mapped_pcm_buffer::open_error_t::out_of_range);
+
+    result = audio::mapped_pcm_buffer::make_shared(
+        {.file_url = test::mapped_pcm_buffer::temporary_test_dir_url().appending("none.raw"), .format = format});
+    XCTAssertFalse(result);
+    XCTAssertEqual(result.error(), audio::mapped_pcm_buffer::open_error_t::open_failed);
+}
+
+- (void)test_open_error_to_string {
+    XCTAssertEqual(to_string(audio::mapped_pcm_buffer::open_error_t::invalid_argument), "invalid_argument");
+    XCTAssertEqual(to_string(audio::mapped_pcm_buffer::open_error_t::invalid_format), "invalid_format");
+    XCTAssertEqual(to_string(audio::mapped_pcm_buffer::open_error_t::open_failed), "open_failed");
+    XCTAssertEqual(to_string(audio::mapped_pcm_buffer::open_error_t::out_of_range), "out_of_range");
+    XCTAssertEqual(to_string(audio::mapped_pcm_buffer::open_error_t::map_failed), "map_failed");
+}
+
+@end
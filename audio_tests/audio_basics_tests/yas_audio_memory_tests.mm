@@ -0,0 +1,88 @@
+//
+//  yas_audio_memory_tests.mm
+//
+
+#import "yas_audio_test_utils.h"
+
+using namespace yas;
+
+@interface yas_audio_memory_tests : XCTestCase
+
+@end
+
+@implementation yas_audio_memory_tests
+
+- (void)setUp {
+    [super setUp];
+}
+
+- (void)tearDown {
+    [super tearDown];
+}
+
+- (void)test_lock {
+    std::size_t const page_size = audio::memory::page_size();
+    std::vector<uint8_t> data(page_size * 4);
+
+    // an unaligned range is counted in the whole pages it touches
+    uint8_t *const begin = data.data() + 1;
+    std::size_t const byte_count = page_size;
+
+    std::size_t const locked_byte_count = audio::memory::locked_byte_count();
+    std::size_t const failed_byte_count = audio::memory::lock_failed_byte_count();
+
+    if (audio::memory::lock(begin, byte_count)) {
+        XCTAssertEqual(audio::memory::locked_byte_count(), locked_byte_count + page_size * 2);
+
+        audio::memory::unlock(begin, byte_count);
+    } else {
+        XCTAssertEqual(audio::memory::lock_failed_byte_count(), failed_byte_count + page_size * 2);
+    }
+
+    XCTAssertEqual(audio::memory::locked_byte_count(), locked_byte_count);
+}
+
+- (void)test_page_aligned_size {
+    std::size_t const page_size = audio::memory::page_size();
+
+    XCTAssertGreaterThan(page_size, 0);
+    XCTAssertEqual(audio::memory::page_aligned_size(0), 0);
+    XCTAssertEqual(audio::memory::page_aligned_size(1), page_size);
+    XCTAssertEqual(audio::memory::page_aligned_size(page_size), page_size);
+    XCTAssertEqual(audio::memory::page_aligned_size(page_size + 1), page_size * 2);
+}
+
+- (void)test_lock_failed {
+    uint8_t data[1] = {0};
+
+    XCTAssertFalse(audio::memory::lock(nullptr, 1));
+    XCTAssertFalse(audio::memory::lock(data, 0));
+}
+
+- (void)test_locked_pcm_buffer {
+    audio::format const format{{.sample_rate = 48000.0, .channel_count = 2}};
+
+    std::size_t const locked_byte_count = audio::memory::locked_byte_count();
+    std::size_t const failed_byte_count = audio::memory::lock_failed_byte_count();
+
+    {
+        audio::pcm_buffer buffer{format, 4096, audio::pcm_buffer::default_alignment, audio::memory_policy::locked};
+
+        std::size_t const slab_size = audio::memory::page_aligned_size(4096 * sizeof(float) * 2);
+        auto const data_address = reinterpret_cast<std::uintptr_t>(buffer.data_ptr_at_index<float>(0));
+
+        XCTAssertEqual(audio::memory::locked_byte_count() + audio::memory::lock_failed_byte_count(),
+                       locked_byte_count + failed_byte_count + slab_size);
+        XCTAssertEqual(data_address % audio::memory::page_size(), 0);
+    }
+
+    XCTAssertEqual(audio::memory::locked_byte_count(), locked_byte_count);
+
+    {
+        audio::pcm_buffer buffer{format, 4096};
+
+        XCTAssertEqual(audio::memory::locked_byte_count(), locked_byte_count);
+    }
+}
+
+@end
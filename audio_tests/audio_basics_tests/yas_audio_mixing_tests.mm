@@ -0,0 +1,81 @@
+//
+//  yas_audio_mixing_tests.mm
+//
+
+#import "yas_audio_test_utils.h"
+
+using namespace yas;
+
+@interface yas_audio_mixing_tests : XCTestCase
+
+@end
+
+@implementation yas_audio_mixing_tests
+
+- (void)setUp {
+    [super setUp];
+}
+
+- (void)tearDown {
+    [super tearDown];
+}
+
+- (void)test_add_with_gain {
+    uint32_t const length = 37;
+
+    for (uint32_t const from_stride : {1, 2}) {
+        for (uint32_t const to_stride : {1, 3}) {
+            std::vector<float> from(length * from_stride, 1.0f);
+            std::vector<float> to(length * to_stride, 0.5f);
+
+            audio::add_with_gain(from.data(), from_stride, to.data(), to_stride, audio::pcm_format::float32, length,
+                                 0.0, 1.0);
+
+            for (uint32_t frame = 0; frame < length; ++frame) {
+                XCTAssertEqualWithAccuracy(to.at(frame * to_stride), 0.5f + static_cast<float>(frame) / length,
+                                           1e-6);
+            }
+        }
+    }
+}
+
+- (void)test_apply_gain {
+    uint32_t const length = 37;
+    std::vector<double> data(length, 2.0);
+
+    audio::apply_gain(data.data(), 1, audio::pcm_format::float64, length, 0.5, 0.5);
+
+    for (double const value : data) {
+        XCTAssertEqual(value, 1.0);
+    }
+
+    audio::apply_gain(data.data(), 1, audio::pcm_format::float64, length, 1.0, 0.0);
+
+    for (uint32_t frame = 0; frame < length; ++frame) {
+        XCTAssertEqualWithAccuracy(data.at(frame), 1.0 - static_cast<double>(frame) / length, 1e-12);
+    }
+}
+
+- (void)test_mixing_failed {
+    float from[1] = {0.0f};
+    float to[1] = {0.0f};
+
+    XCTAssertThrows(audio::add_with_gain(nullptr, 1, to, 1, audio::pcm_format::float32, 1, 1.0, 1.0));
+    XCTAssertThrows(audio::add_with_gain(from, 1, to, 0, audio::pcm_format::float32, 1, 1.0, 1.0));
+    XCTAssertThrows(audio::add_with_gain(from, 1, to, 1, audio::pcm_format::int16, 1, 1.0, 1.0));
+    XCTAssertThrows(audio::apply_gain(to, 1, audio::pcm_format::fixed824, 1, 1.0, 1.0));
+}
+
+- (void)test_add_with_gain_performance {
+    uint32_t const length = 512;
+    std::vector<float> from(length);
+    std::vector<float> to(length);
+
+    [self measureBlock:^{
+        for (uint32_t i = 0; i < 10000; ++i) {
+            audio::add_with_gain(from.data(), 1, to.data(), 1, audio::pcm_format::float32, length, 0.5, 1.0);
+        }
+    }];
+}
+
+@end
@@ -0,0 +1,189 @@
+//
+//  yas_audio_pcm_buffer_pool_tests.mm
+//
+
+#import "yas_audio_test_utils.h"
+
+using namespace yas;
+using namespace yas::audio;
+
+@interface yas_audio_pcm_buffer_pool_tests : XCTestCase
+
+@end
+
+@implementation yas_audio_pcm_buffer_pool_tests
+
+- (void)setUp {
+    [super setUp];
+}
+
+- (void)tearDown {
+    [super tearDown];
+}
+
+- (void)test_capacity_class {
+    XCTAssertEqual(audio::pcm_buffer_pool::capacity_class(1), 1);
+    XCTAssertEqual(audio::pcm_buffer_pool::capacity_class(3), 4);
+    XCTAssertEqual(audio::pcm_buffer_pool::capacity_class(512), 512);
+    XCTAssertEqual(audio::pcm_buffer_pool::capacity_class(513), 1024);
+}
+
+- (void)test_reserve {
+    auto const pool = audio::pcm_buffer_pool::make_shared();
+    auto const format = audio::format({.sample_rate = 48000.0, .channel_count = 2});
+    auto const other_format = audio::format({.sample_rate = 44100.0, .channel_count = 2});
+
+    auto const key = pool->reserve(format, 500, 2);
+
+    XCTAssertEqual(pool->reserve(format, 512), key);
+    XCTAssertNotEqual(pool->reserve(format, 513), key);
+    XCTAssertNotEqual(pool->reserve(other_format, 500), key);
+
+    XCTAssertEqual(pool->key(format, 300), key);
+    XCTAssertFalse(pool->key(format, 100));
+
+    auto const usages = pool->usages();
+    XCTAssertEqual(usages.size(), 3);
+    XCTAssertTrue(usages.at(key).format == format);
+    XCTAssertEqual(usages.at(key).frame_capacity, 512);
+    XCTAssertEqual(usages.at(key).buffer_count, 3);
+
+    XCTAssertThrows(pool->reserve(format, 0));
+    XCTAssertThrows(pool->reserve(format, 512, 0));
+}
+
+- (void)test_acquire_and_release {
+    auto const pool = audio::pcm_buffer_pool::make_shared();
+    auto const format = audio::format({.sample_rate = 48000.0, .channel_count = 2});
+
+    auto const key = pool->reserve(format, 256, 2);
+
+    audio::pcm_buffer *const buffer1 = pool->acquire(key);
+    audio::pcm_buffer *const buffer2 = pool->acquire(key);
+
+    XCTAssertTrue(buffer1 != nullptr);
+    XCTAssertTrue(buffer2 != nullptr);
+    XCTAssertTrue(buffer1 != buffer2);
+    XCTAssertTrue(buffer1->format() == format);
+    XCTAssertEqual(buffer1->frame_capacity(), 256);
+
+    XCTAssertTrue(pool->acquire(key) == nullptr);
+
+    buffer1->set_frame_length(10);
+    pool->release(key, buffer1);
+
+    audio::pcm_buffer *const buffer3 = pool->acquire(key);
+    XCTAssertTrue(buffer3 == buffer1);
+    XCTAssertEqual(buffer3->frame_length(), 256);
+
+    pool->release(key, buffer2);
+    pool->release(key, buffer3);
+
+    audio::pcm_buffer other_buffer(format, 256);
+    XCTAssertThrows(pool->release(key, &other_buffer));
+    XCTAssertThrows(pool->acquire(key + 1));
+}
+
+- (void)test_high_water_mark {
+    auto const pool = audio::pcm_buffer_pool::make_shared();
+    auto const format = audio::format({.sample_rate = 48000.0, .channel_count = 1});
+
+    auto const key = pool->reserve(format, 64, 3);
+
+    audio::pcm_buffer *const buffer1 = pool->acquire(key);
+    audio::pcm_buffer *const buffer2 = pool->acquire(key);
+    pool->release(key, buffer2);
+    pool->release(key, buffer1);
+
+    XCTAssertEqual(pool->usages().at(key).high_water_mark, 2);
+    XCTAssertEqual(pool->usages().at(key).exhausted_count, 0);
+
+    std::vector<audio::pcm_buffer *> buffers;
+    for (uint32_t i = 0; i < 4; ++i) {
+        buffers.push_back(pool->acquire(key));
+    }
+
+    XCTAssertTrue(buffers.at(3) == nullptr);
+    XCTAssertEqual(pool->usages().at(key).high_water_mark, 3);
+    XCTAssertEqual(pool->usages().at(key).exhausted_count, 1);
+
+    for (uint32_t i = 0; i < 3; ++i) {
+        pool->release(key, buffers.at(i));
+    }
+
+    pool->reset_high_water_marks();
+
+    XCTAssertEqual(pool->usages().at(key).high_water_mark, 0);
+    XCTAssertEqual(pool->usages().at(key).exhausted_count, 0);
+}
+
+- (void)test_reserve_while_in_use {
+    auto const pool = audio::pcm_buffer_pool::make_shared();
+    auto const format = audio::format({.sample_rate = 48000.0, .channel_count = 1});
+
+    auto const key = pool->reserve(format, 64);
+
+    audio::pcm_buffer *const buffer1 = pool->acquire(key);
+    XCTAssertTrue(pool->acquire(key) == nullptr);
+
+    for (uint32_t i = 0; i < 100; ++i) {
+        XCTAssertEqual(pool->reserve(format, 64), key);
+    }
+
+    XCTAssertEqual(pool->usages().at(key).buffer_count, 101);
+
+    std::vector<audio::pcm_buffer *> buffers;
+    for (uint32_t i = 0; i < 100; ++i) {
+        buffers.push_back(pool->acquire(key));
+        XCTAssertTrue(buffers.back() != nullptr);
+        XCTAssertTrue(buffers.back() != buffer1);
+    }
+
+    XCTAssertTrue(pool->acquire(key) == nullptr);
+
+    pool->release(key, buffer1);
+    for (auto *const buffer : buffers) {
+        pool->release(key, buffer);
+    }
+
+    XCTAssertEqual(pool->usages().at(key).high_water_mark, 101);
+}
+
+- (void)test_unreserve {
+    auto const pool = audio::pcm_buffer_pool::make_shared();
+    auto const format = audio::format({.sample_rate = 48000.0, .channel_count = 1});
+
+    auto const key = pool->reserve(format, 64, 3);
+
+    audio::pcm_buffer *const buffer = pool->acquire(key);
+
+    pool->unreserve(key, 2);
+
+    XCTAssertEqual(pool->usages().at(key).buffer_count, 1);
+    XCTAssertTrue(pool->acquire(key) == nullptr);
+
+    pool->unreserve(key);
+
+    XCTAssertEqual(pool->usages().at(key).buffer_count, 1);
+
+    pool->release(key, buffer);
+
+    XCTAssertEqual(pool->reserve(format, 64, 2), key);
+    XCTAssertEqual(pool->usages().at(key).buffer_count, 2);
+
+    audio::pcm_buffer *const buffer1 = pool->acquire(key);
+    audio::pcm_buffer *const buffer2 = pool->acquire(key);
+
+    XCTAssertTrue(buffer1 != nullptr);
+    XCTAssertTrue(buffer2 != nullptr);
+    XCTAssertTrue(pool->acquire(key) == nullptr);
+
+    pool->release(key, buffer1);
+    pool->release(key, buffer2);
+
+    XCTAssertThrows(pool->unreserve(key, 3));
+    XCTAssertThrows(pool->unreserve(key, 0));
+    XCTAssertThrows(pool->unreserve(key + 1));
+}
+
+@end
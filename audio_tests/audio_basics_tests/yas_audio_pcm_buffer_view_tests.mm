@@ -0,0 +1,143 @@
+//
+//  yas_audio_pcm_buffer_view_tests.mm
+//
+
+#import "yas_audio_test_utils.h"
+
+using namespace yas;
+using namespace yas::audio;
+
+@interface yas_audio_pcm_buffer_view_tests : XCTestCase
+
+@end
+
+@implementation yas_audio_pcm_buffer_view_tests
+
+- (void)setUp {
+    [super setUp];
+}
+
+- (void)tearDown {
+    [super tearDown];
+}
+
+- (void)test_create_view_with_channel_map {
+    uint32_t const frame_length = 4;
+    audio::channel_map_t const channel_map{1, static_cast<uint32_t>(-1), 0};
+
+    auto const dst_format = audio::format({.sample_rate = 48000.0, .channel_count = 2});
+    audio::pcm_buffer dst_buffer(dst_format, frame_length);
+    test::fill_test_values_to_buffer(dst_buffer);
+
+    auto const src_format = audio::format({.sample_rate = 48000.0, .channel_count = 3});
+    audio::pcm_buffer_view const src_view(src_format, dst_buffer, channel_map);
+    auto const &src_buffer = src_view.buffer();
+
+    XCTAssertTrue(src_buffer.format() == src_format);
+    XCTAssertEqual(src_buffer.frame_length(), frame_length);
+    XCTAssertEqual(src_buffer.audio_buffer_list()->mNumberBuffers, 3);
+
+    XCTAssertEqual(src_buffer.data_ptr_at_index<float>(0), dst_buffer.data_ptr_at_index<float>(1));
+    XCTAssertTrue(src_buffer.data_ptr_at_index<float>(1) != nullptr);
+    XCTAssertEqual(src_buffer.data_ptr_at_index<float>(2), dst_buffer.data_ptr_at_index<float>(0));
+
+    for (uint32_t frame = 0; frame < frame_length; ++frame) {
+        float const test_value_0 = test::test_value(frame, 0, 1);
+        float const test_value_2 = test::test_value(frame, 0, 0);
+        XCTAssertEqual(src_buffer.data_ptr_at_index<float>(0)[frame], test_value_0);
+        XCTAssertEqual(src_buffer.data_ptr_at_index<float>(2)[frame], test_value_2);
+    }
+}
+
+- (void)test_create_view_with_short_frame_length {
+    auto const format = audio::format({.sample_rate = 48000.0, .channel_count = 2});
+    audio::pcm_buffer dst_buffer(format, 4);
+    dst_buffer.set_frame_length(2);
+
+    audio::pcm_buffer_view const view(format, dst_buffer, {0, 1});
+
+    XCTAssertEqual(view.buffer().frame_length(), 2);
+    XCTAssertEqual(view.buffer().audio_buffer_list()->mBuffers[0].mDataByteSize, 2 * sizeof(float));
+}
+
+- (void)test_create_view_with_channel_map_pointer {
+    auto const format = audio::format({.sample_rate = 48000.0, .channel_count = 2});
+    audio::pcm_buffer dst_buffer(format, 4);
+    uint32_t const channel_map[2] = {1, 0};
+
+    audio::pcm_buffer_view const view(format, dst_buffer, channel_map);
+
+    XCTAssertEqual(view.buffer().data_ptr_at_index<float>(0), dst_buffer.data_ptr_at_index<float>(1));
+    XCTAssertEqual(view.buffer().data_ptr_at_index<float>(1), dst_buffer.data_ptr_at_index<float>(0));
+}
+
+- (void)test_create_view_failed {
+    auto const format = audio::format({.sample_rate = 48000.0, .channel_count = 2});
+    auto const interleaved_format =
+        audio::format({.sample_rate = 48000.0, .channel_count = 2, .interleaved = true});
+    auto const int16_format =
+        audio::format({.sample_rate = 48000.0, .channel_count = 2, .pcm_format = audio::pcm_format::int16});
+
+    audio::pcm_buffer buffer(format, 4);
+    audio::pcm_buffer interleaved_buffer(interleaved_format, 4);
+
+    XCTAssertThrows(audio::pcm_buffer_view(format, buffer, {0}));
+    XCTAssertThrows(audio::pcm_buffer_view(interleaved_format, buffer, {0, 1}));
+    XCTAssertThrows(audio::pcm_buffer_view(format, interleaved_buffer, {0, 1}));
+    XCTAssertThrows(audio::pcm_buffer_view(int16_format, buffer, {0, 1}));
+    XCTAssertThrows(audio::pcm_buffer_view(format, buffer, {0, 2}));
+}
+
+- (void)test_create_slice_view {
+    for (bool const interleaved : {false, true}) {
+        auto const format = audio::format({.sample_rate = 48000.0, .channel_count = 2, .interleaved = interleaved});
+        audio::pcm_buffer buffer(format, 8);
+        test::fill_test_values_to_buffer(buffer);
+
+        audio::pcm_buffer_view view(buffer, 3, 4);
+        auto &sliced_buffer = view.buffer();
+
+        XCTAssertTrue(sliced_buffer.format() == format);
+        XCTAssertEqual(sliced_buffer.frame_length(), 4);
+        XCTAssertEqual(sliced_buffer.frame_capacity(), 4);
+
+        for (uint32_t buf_idx = 0; buf_idx < format.buffer_count(); ++buf_idx) {
+            XCTAssertEqual(sliced_buffer.data_ptr_at_index<float>(buf_idx),
+                           buffer.data_ptr_at_index<float>(buf_idx) + 3 * format.stride());
+        }
+
+        sliced_buffer.clear();
+
+        for (uint32_t ch_idx = 0; ch_idx < 2; ++ch_idx) {
+            float const *const data = buffer.data_ptr_at_channel<float>(ch_idx);
+            for (uint32_t frame = 0; frame < 8; ++frame) {
+                bool const is_sliced = 3 <= frame && frame < 7;
+                XCTAssertEqual(data[frame * format.stride()] == 0.0f, is_sliced);
+            }
+        }
+    }
+}
+
+- (void)test_create_slice_view_failed {
+    auto const format = audio::format({.sample_rate = 48000.0, .channel_count = 2});
+    audio::pcm_buffer buffer(format, 8);
+    buffer.set_frame_length(6);
+
+    XCTAssertNoThrow(audio::pcm_buffer_view(buffer, 6, 0));
+    XCTAssertThrows(audio::pcm_buffer_view(buffer, 3, 4));
+    XCTAssertThrows(audio::pcm_buffer_view(buffer, 7, 0));
+    XCTAssertThrows(audio::pcm_buffer_view(buffer, 1, std::numeric_limits<uint32_t>::max()));
+}
+
+- (void)test_is_available {
+    XCTAssertTrue(audio::pcm_buffer_view::is_available(
+        audio::format({.sample_rate = 48000.0, .channel_count = audio::pcm_buffer_view::max_buffer_count})));
+    XCTAssertFalse(audio::pcm_buffer_view::is_available(
+        audio::format({.sample_rate = 48000.0, .channel_count = audio::pcm_buffer_view::max_buffer_count + 1})));
+    XCTAssertFalse(audio::pcm_buffer_view::is_available(
+        audio::format({.sample_rate = 48000.0, .channel_count = 2, .interleaved = true})));
+    XCTAssertFalse(audio::pcm_buffer_view::is_available(audio::format(
+        {.sample_rate = 48000.0, .channel_count = audio::pcm_buffer_view::max_buffer_count + 1, .interleaved = true})));
+}
+
+@end
@@ -0,0 +1,183 @@
+//
+//  yas_audio_pcm_ring_buffer_tests.mm
+//
+
+#import "yas_audio_test_utils.h"
+#import <thread>
+
+using namespace yas;
+
+@interface yas_audio_pcm_ring_buffer_tests : XCTestCase
+
+@end
+
+@implementation yas_audio_pcm_ring_buffer_tests
+
+- (void)setUp {
+    [super setUp];
+}
+
+- (void)tearDown {
+    [super tearDown];
+}
+
+- (void)test_make_shared {
+    audio::format const format{{.sample_rate = 48000.0, .channel_count = 2}};
+    auto const ring_buffer = audio::pcm_ring_buffer::make_shared(format, 16);
+
+    XCTAssertTrue(ring_buffer->format() == format);
+    XCTAssertEqual(ring_buffer->frame_capacity(), 16);
+    XCTAssertEqual(ring_buffer->readable_frames(), 0);
+    XCTAssertEqual(ring_buffer->writable_frames(), 16);
+    XCTAssertEqual(ring_buffer->overflow_frames(), 0);
+    XCTAssertEqual(ring_buffer->underflow_frames(), 0);
+
+    XCTAssertThrows(audio::pcm_ring_buffer::make_shared(format, 0));
+}
+
+- (void)test_write_and_read {
+    audio::format const format{{.sample_rate = 48000.0, .channel_count = 2}};
+    audio::format const interleaved_format{{.sample_rate = 48000.0, .channel_count = 2, .interleaved = true}};
+    auto const ring_buffer = audio::pcm_ring_buffer::make_shared(format, 10);
+
+    audio::pcm_buffer from_buffer{interleaved_format, 7};
+    test::fill_test_values_to_buffer(from_buffer);
+    audio::pcm_buffer to_buffer{format, 8};
+
+    XCTAssertEqual(ring_buffer->write(from_buffer).value(), 7);
+    XCTAssertEqual(ring_buffer->readable_frames(), 7);
+
+    XCTAssertEqual(ring_buffer->read(to_buffer).value(), 7);
+    XCTAssertEqual(to_buffer.frame_length(), 7);
+    XCTAssertEqual(ring_buffer->readable_frames(), 0);
+    XCTAssertEqual(ring_buffer->underflow_frames(), 1);
+
+    for (uint32_t ch_idx = 0; ch_idx < 2; ++ch_idx) {
+        for (uint32_t frame = 0; frame < 7; ++frame) {
+            XCTAssertEqual(to_buffer.data_ptr_at_channel<float>(ch_idx)[frame], test::test_value(frame, ch_idx, 0));
+        }
+    }
+}
+
+- (void)test_wrap_around {
+    audio::format const format{{.sample_rate = 48000.0, .channel_count = 1}};
+    auto const ring_buffer = audio::pcm_ring_buffer::make_shared(format, 10);
+
+    audio::pcm_buffer from_buffer{format, 7};
+    audio::pcm_buffer to_buffer{format, 10};
+    for (uint32_t frame = 0; frame < 7; ++frame) {
+        from_buffer.data_ptr_at_index<float>(0)[frame] = static_cast<float>(frame);
+    }
+
+    XCTAssertEqual(ring_buffer->write(from_buffer).value(), 7);
+    XCTAssertEqual(ring_buffer->read(to_buffer).value(), 7);
+
+    XCTAssertEqual(ring_buffer->write(from_buffer).value(), 7);
+    XCTAssertEqual(ring_buffer->write(from_buffer).value(), 3);
+    XCTAssertEqual(ring_buffer->overflow_frames(), 4);
+
+    auto const segments = ring_buffer->begin_read(10);
+
+    XCTAssertEqual(segments.first.begin_frame, 7);
+    XCTAssertEqual(segments.first.length, 3);
+    XCTAssertEqual(segments.second.begin_frame, 0);
+    XCTAssertEqual(segments.second.length, 7);
+    XCTAssertEqual(segments.length(), 10);
+
+    ring_buffer->end_read(segments.length());
+
+    XCTAssertEqual(ring_buffer->readable_frames(), 0);
+
+    XCTAssertEqual(ring_buffer->write(from_buffer).value(), 7);
+    XCTAssertEqual(ring_buffer->read(to_buffer).value(), 7);
+
+    for (uint32_t frame = 0; frame < 7; ++frame) {
+        XCTAssertEqual(to_buffer.data_ptr_at_index<float>(0)[frame], static_cast<float>(frame));
+    }
+}
+
+- (void)test_begin_write {
+    audio::format const format{{.sample_rate = 48000.0, .channel_count = 1}};
+    auto const ring_buffer = audio::pcm_ring_buffer::make_shared(format, 4);
+
+    auto const segments = ring_buffer->begin_write(6);
+
+    XCTAssertEqual(segments.first.begin_frame, 0);
+    XCTAssertEqual(segments.first.length, 4);
+    XCTAssertEqual(segments.second.length, 0);
+    XCTAssertEqual(ring_buffer->overflow_frames(), 2);
+
+    float *const data = ring_buffer->buffer().data_ptr_at_index<float>(0);
+    for (uint32_t frame = 0; frame < segments.first.length; ++frame) {
+        data[segments.first.begin_frame + frame] = 1.0f;
+    }
+
+    XCTAssertEqual(ring_buffer->readable_frames(), 0);
+
+    ring_buffer->end_write(segments.length());
+
+    XCTAssertEqual(ring_buffer->readable_frames(), 4);
+    XCTAssertThrows(ring_buffer->end_write(1));
+
+    ring_buffer->reset_counters();
+
+    XCTAssertEqual(ring_buffer->overflow_frames(), 0);
+}
+
+- (void)test_invalid_format {
+    audio::format const format{{.sample_rate = 48000.0, .channel_count = 2}};
+    audio::format const mono_format{{.sample_rate = 48000.0, .channel_count = 1}};
+    auto const ring_buffer = audio::pcm_ring_buffer::make_shared(format, 4);
+    audio::pcm_buffer buffer{mono_format, 4};
+
+    auto result = ring_buffer->write(buffer);
+    XCTAssertFalse(result);
+    XCTAssertEqual(result.error(), audio::pcm_buffer::copy_error_t::invalid_format);
+
+    result = ring_buffer->read(buffer);
+    XCTAssertFalse(result);
+    XCTAssertEqual(result.error(), audio::pcm_buffer::copy_error_t::invalid_format);
+}
+
+- (void)test_threads {
+    audio::format const format{{.sample_rate = 48000.0, .channel_count = 1}};
+    auto const ring_buffer = audio::pcm_ring_buffer::make_shared(format, 97);
+    uint32_t const total_length = 100000;
+
+    std::thread writer{[ring_buffer, format, total_length] {
+        audio::pcm_buffer buffer{format, 13};
+        uint32_t written = 0;
+        while (written < total_length) {
+            buffer.set_frame_length(std::min(13u, total_length - written));
+            for (uint32_t frame = 0; frame < buffer.frame_length(); ++frame) {
+                buffer.data_ptr_at_index<float>(0)[frame] = static_cast<float>(written + frame);
+            }
+            uint32_t const length = ring_buffer->write(buffer).value();
+            if (length == 0) {
+                std::this_thread::yield();
+            }
+            written += length;
+        }
+    }};
+
+    audio::pcm_buffer buffer{format, 17};
+    uint32_t read = 0;
+    bool is_matched = true;
+    while (read < total_length) {
+        uint32_t const length = ring_buffer->read(buffer).value();
+        for (uint32_t frame = 0; frame < length; ++frame) {
+            is_matched &= buffer.data_ptr_at_index<float>(0)[frame] == static_cast<float>(read + frame);
+        }
+        if (length == 0) {
+            std::this_thread::yield();
+        }
+        read += length;
+    }
+
+    writer.join();
+
+    XCTAssertTrue(is_matched);
+    XCTAssertEqual(read, total_length);
+}
+
+@end
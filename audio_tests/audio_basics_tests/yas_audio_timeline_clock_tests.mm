@@ -0,0 +1,112 @@
+//
+//  yas_audio_timeline_clock_tests.mm
+//
+
+#import "yas_audio_test_utils.h"
+
+using namespace yas;
+
+@interface yas_audio_timeline_clock_tests : XCTestCase
+
+@end
+
+@implementation yas_audio_timeline_clock_tests
+
+- (void)setUp {
+    [super setUp];
+}
+
+- (void)tearDown {
+    [super tearDown];
+}
+
+- (void)test_make_shared {
+    auto const clock = audio::timeline_clock::make_shared(48000.0);
+
+    XCTAssertEqual(clock->sample_rate(), 48000.0);
+    XCTAssertEqual(clock->sample_time(), 0);
+    XCTAssertFalse(clock->is_synchronized());
+    XCTAssertEqual(clock->rate_scalar(), 1.0);
+    XCTAssertEqual(clock->drift_samples(), 0.0);
+    XCTAssertFalse(clock->host_time_for_sample_time(0));
+    XCTAssertFalse(clock->sample_time_for_host_time(0));
+
+    XCTAssertThrows(audio::timeline_clock::make_shared(0.0));
+}
+
+- (void)test_advance_beyond_32bit {
+    auto const clock = audio::timeline_clock::make_shared(48000.0);
+
+    clock->reset(int64_t(1) << 33);
+
+    for (uint32_t i = 0; i < 4; ++i) {
+        clock->advance(std::numeric_limits<uint32_t>::max());
+    }
+
+    int64_t const expected = (int64_t(1) << 33) + int64_t(std::numeric_limits<uint32_t>::max()) * 4;
+
+    XCTAssertEqual(clock->sample_time(), expected);
+
+    auto const time = clock->time();
+
+    XCTAssertEqual(time.sample_time(), expected);
+    XCTAssertEqual(time.sample_rate(), 48000.0);
+    XCTAssertEqual(time.audio_time_stamp().mFlags, kAudioTimeStampSampleTimeValid);
+}
+
+- (void)test_synchronize_and_estimate_drift {
+    auto const clock = audio::timeline_clock::make_shared(48000.0);
+    uint64_t const begin_host_time = audio::host_time_for_seconds(100.0);
+    double const actual_sample_rate = 48000.0 * 1.0001;
+
+    for (uint32_t i = 0; i <= 1000; ++i) {
+        double const seconds = i * 0.01;
+        clock->synchronize(begin_host_time + audio::host_time_for_seconds(seconds),
+                           std::llround(seconds * actual_sample_rate));
+    }
+
+    XCTAssertTrue(clock->is_synchronized());
+    XCTAssertEqualWithAccuracy(clock->rate_scalar(), 1.0001, 0.000001);
+    XCTAssertEqualWithAccuracy(clock->drift_samples(), 48.0, 1.0);
+
+    int64_t const sample_time = std::llround(20.0 * actual_sample_rate);
+    auto const host_time = clock->host_time_for_sample_time(sample_time);
+
+    XCTAssertTrue(host_time);
+    XCTAssertEqualWithAccuracy(audio::seconds_for_host_time(host_time.value()), 120.0, 0.0001);
+
+    auto const mapped_sample_time = clock->sample_time_for_host_time(host_time.value());
+
+    XCTAssertTrue(mapped_sample_time);
+    XCTAssertEqualWithAccuracy(mapped_sample_time.value(), sample_time, 1);
+
+    auto const time = clock->time();
+
+    XCTAssertEqual(time.sample_time(), clock->sample_time());
+    XCTAssertEqual(time.audio_time_stamp().mFlags,
+                   kAudioTimeStampSampleHostTimeValid | kAudioTimeStampRateScalarValid);
+    XCTAssertEqualWithAccuracy(time.audio_time_stamp().mRateScalar, 1.0001, 0.000001);
+}
+
+- (void)test_synchronize_with_discontinuity {
+    auto const clock = audio::timeline_clock::make_shared(44100.0);
+    uint64_t const host_time = audio::host_time_for_seconds(10.0);
+
+    clock->synchronize(host_time, 0);
+    clock->synchronize(host_time + audio::host_time_for_seconds(1.0), 44000);
+
+    XCTAssertNotEqual(clock->rate_scalar(), 1.0);
+
+    clock->synchronize(audio::time{host_time + audio::host_time_for_seconds(2.0), 100, 44100.0});
+
+    XCTAssertEqual(clock->rate_scalar(), 1.0);
+    XCTAssertEqual(clock->drift_samples(), 0.0);
+    XCTAssertEqual(clock->sample_time(), 100);
+
+    clock->reset(500);
+
+    XCTAssertFalse(clock->is_synchronized());
+    XCTAssertEqual(clock->sample_time(), 500);
+}
+
+@end
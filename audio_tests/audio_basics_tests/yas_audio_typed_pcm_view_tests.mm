@@ -0,0 +1,116 @@
+//
+//  yas_audio_typed_pcm_view_tests.mm
+//
+
+#import "yas_audio_test_utils.h"
+
+using namespace yas;
+
+@interface yas_audio_typed_pcm_view_tests : XCTestCase
+
+@end
+
+@implementation yas_audio_typed_pcm_view_tests
+
+- (void)setUp {
+    [super setUp];
+}
+
+- (void)tearDown {
+    [super tearDown];
+}
+
+- (void)test_interleaved_view {
+    audio::format const format{{.sample_rate = 48000.0, .channel_count = 2, .interleaved = true}};
+    audio::pcm_buffer buffer{format, 4};
+
+    audio::interleaved_pcm_view<float> const view{buffer};
+
+    XCTAssertEqual(view.channel_count(), 2);
+    XCTAssertEqual(view.stride(), 2);
+    XCTAssertEqual(view.frame_length(), 4);
+    XCTAssertEqual(view.data_at_channel(0), buffer.data_ptr_at_index<float>(0));
+    XCTAssertEqual(view.data_at_channel(1), buffer.data_ptr_at_index<float>(0) + 1);
+
+    for (uint32_t frame = 0; frame < view.frame_length(); ++frame) {
+        view.at(0, frame) = static_cast<float>(frame);
+        view.at(1, frame) = -static_cast<float>(frame);
+    }
+
+    float const *const data = buffer.data_ptr_at_index<float>(0);
+    for (uint32_t frame = 0; frame < 4; ++frame) {
+        XCTAssertEqual(data[frame * 2], static_cast<float>(frame));
+        XCTAssertEqual(data[frame * 2 + 1], -static_cast<float>(frame));
+    }
+}
+
+- (void)test_non_interleaved_view {
+    audio::format const format{
+        {.sample_rate = 48000.0, .channel_count = 3, .pcm_format = audio::pcm_format::int16}};
+    audio::pcm_buffer buffer{format, 4};
+    buffer.set_frame_length(2);
+
+    audio::non_interleaved_pcm_view<int16_t, 3> const view{buffer};
+
+    XCTAssertEqual(view.channel_count(), 3);
+    XCTAssertEqual(view.stride(), 1);
+    XCTAssertEqual(view.frame_length(), 2);
+
+    for (uint32_t ch_idx = 0; ch_idx < 3; ++ch_idx) {
+        XCTAssertEqual(view.data_at_channel(ch_idx), buffer.data_ptr_at_channel<int16_t>(ch_idx));
+    }
+
+    view.at(2, 1) = 5;
+
+    XCTAssertEqual(buffer.data_ptr_at_channel<int16_t>(2)[1], 5);
+}
+
+- (void)test_const_view {
+    audio::format const format{{.sample_rate = 48000.0, .channel_count = 1}};
+    audio::pcm_buffer buffer{format, 2};
+    buffer.data_ptr_at_index<float>(0)[1] = 0.5f;
+
+    audio::pcm_buffer const &const_buffer = buffer;
+    audio::non_interleaved_pcm_view<float const> const view{const_buffer};
+
+    XCTAssertEqual(view.at(0, 1), 0.5f);
+}
+
+- (void)test_create_view_failed {
+    audio::format const format{{.sample_rate = 48000.0, .channel_count = 2}};
+    audio::format const interleaved_format{{.sample_rate = 48000.0, .channel_count = 2, .interleaved = true}};
+    audio::pcm_buffer buffer{format, 4};
+    audio::pcm_buffer interleaved_buffer{interleaved_format, 4};
+
+    XCTAssertThrows(audio::interleaved_pcm_view<float>{buffer});
+    XCTAssertThrows(audio::non_interleaved_pcm_view<float>{interleaved_buffer});
+    XCTAssertThrows(audio::non_interleaved_pcm_view<double>{buffer});
+    XCTAssertThrows((audio::non_interleaved_pcm_view<float, 1>{buffer}));
+}
+
+- (void)test_is_available {
+    audio::format const mono_format{{.sample_rate = 48000.0, .channel_count = 1, .interleaved = true}};
+
+    XCTAssertTrue(audio::interleaved_pcm_view<float>::is_available(mono_format));
+    XCTAssertTrue(audio::non_interleaved_pcm_view<float>::is_available(mono_format));
+    XCTAssertTrue((audio::non_interleaved_pcm_view<float, 1>::is_available(mono_format)));
+    XCTAssertFalse((audio::non_interleaved_pcm_view<float, 2>::is_available(mono_format)));
+    XCTAssertFalse(audio::non_interleaved_pcm_view<int32_t>::is_available(mono_format));
+}
+
+- (void)test_view_performance {
+    audio::format const format{{.sample_rate = 48000.0, .channel_count = 2, .interleaved = true}};
+    audio::pcm_buffer buffer{format, 512};
+
+    [self measureBlock:^{
+        for (uint32_t i = 0; i < 10000; ++i) {
+            audio::interleaved_pcm_view<float, 2> const view{buffer};
+            for (uint32_t frame = 0; frame < view.frame_length(); ++frame) {
+                view.at(0, frame) *= 0.5f;
+                view.at(1, frame) *= 0.5f;
+            }
+        }
+    }];
+}
+
+@end
@@ -30,6 +30,8 @@ using namespace yas;
     XCTAssertTrue(to_string(audio::pcm_format::float64) == "Float64");
     XCTAssertTrue(to_string(audio::pcm_format::int16) == "Int16");
     XCTAssertTrue(to_string(audio::pcm_format::fixed824) == "Fixed8.24");
+    XCTAssertTrue(to_string(audio::pcm_format::int24) == "Int24");
+    XCTAssertTrue(to_string(audio::pcm_format::float16) == "Float16");
     XCTAssertTrue(to_string(audio::pcm_format::other) == "Other");
 }
 
@@ -38,12 +40,15 @@ using namespace yas;
     XCTAssertTrue(to_sample_type(audio::pcm_format::float64) == typeid(double));
     XCTAssertTrue(to_sample_type(audio::pcm_format::int16) == typeid(int16_t));
     XCTAssertTrue(to_sample_type(audio::pcm_format::fixed824) == typeid(int32_t));
+    XCTAssertTrue(to_sample_type(audio::pcm_format::int24) == typeid(audio::int24_t));
+    XCTAssertTrue(to_sample_type(audio::pcm_format::float16) == typeid(audio::float16_t));
     XCTAssertTrue(to_sample_type(audio::pcm_format::other) == typeid(std::nullptr_t));
 }
 
 - (void)test_pcm_format_ostream {
     auto const errors = {audio::pcm_format::float32, audio::pcm_format::float64, audio::pcm_format::int16,
-                         audio::pcm_format::fixed824, audio::pcm_format::other};
+                         audio::pcm_format::fixed824, audio::pcm_format::int24,   audio::pcm_format::float16,
+                         audio::pcm_format::other};
 
     for (auto const &error : errors) {
         std::ostringstream stream;
@@ -97,6 +102,21 @@ using namespace yas;
     }
 }
 
+- (void)test_memory_policy_to_string {
+    XCTAssertEqual(to_string(audio::memory_policy::standard), "standard");
+    XCTAssertEqual(to_string(audio::memory_policy::locked), "locked");
+}
+
+- (void)test_memory_policy_ostream {
+    auto const values = {audio::memory_policy::standard, audio::memory_policy::locked};
+
+    for (auto const &value : values) {
+        std::ostringstream stream;
+        stream << value;
+        XCTAssertEqual(stream.str(), to_string(value));
+    }
+}
+
 - (void)test_audio_error_to_string {
     OSStatus err = noErr;
     XCTAssertEqual(to_string(err), "noErr");
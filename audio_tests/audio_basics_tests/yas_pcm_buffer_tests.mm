@@ -559,6 +559,62 @@ using namespace yas::audio;
     XCTAssertEqual(dst_ptr_1[3], 0);
 }
 
+- (void)test_copy_channel_int24_data_interleaved_to_deinterleaved {
+    double const sample_rate = 48000.0;
+    uint32_t const frame_length = 4;
+    uint32_t const channels = 2;
+
+    audio::format src_format{{.sample_rate = sample_rate,
+                              .channel_count = channels,
+                              .pcm_format = audio::pcm_format::int24,
+                              .interleaved = true}};
+    audio::format dst_format{{.sample_rate = sample_rate,
+                              .channel_count = channels,
+                              .pcm_format = audio::pcm_format::int24,
+                              .interleaved = false}};
+    audio::pcm_buffer src_buffer{src_format, frame_length};
+    audio::pcm_buffer dst_buffer{dst_format, frame_length};
+
+    audio::int24_t *const src_ptr = src_buffer.data_ptr_at_channel<audio::int24_t>(0);
+    for (uint32_t frame = 0; frame < frame_length; ++frame) {
+        src_ptr[frame * 2] = audio::to_int24(10 + frame);
+        src_ptr[frame * 2 + 1] = audio::to_int24(-20 - static_cast<int32_t>(frame));
+    }
+
+    dst_buffer.copy_channel_from(src_buffer, {.from_channel = 1, .to_channel = 0});
+
+    audio::int24_t const *const dst_ptr_0 = dst_buffer.data_ptr_at_channel<audio::int24_t>(0);
+    audio::int24_t const *const dst_ptr_1 = dst_buffer.data_ptr_at_channel<audio::int24_t>(1);
+
+    XCTAssertEqual(audio::to_int32(dst_ptr_0[0]), -20);
+    XCTAssertEqual(audio::to_int32(dst_ptr_0[1]), -21);
+    XCTAssertEqual(audio::to_int32(dst_ptr_0[2]), -22);
+    XCTAssertEqual(audio::to_int32(dst_ptr_0[3]), -23);
+    XCTAssertEqual(audio::to_int32(dst_ptr_1[0]), 0);
+    XCTAssertEqual(audio::to_int32(dst_ptr_1[3]), 0);
+}
+
+- (void)test_convert_from_float16 {
+    audio::format const src_format{{.sample_rate = 48000.0,
+                                    .channel_count = 2,
+                                    .pcm_format = audio::pcm_format::float16,
+                                    .interleaved = false}};
+    audio::pcm_buffer src_buffer{src_format, 4};
+    audio::pcm_buffer dst_buffer{audio::format{{.sample_rate = 48000.0, .channel_count = 2}}, 4};
+
+    audio::float16_t *const src_ptr = src_buffer.data_ptr_at_channel<audio::float16_t>(1);
+    src_ptr[0] = audio::to_float16(0.5f);
+    src_ptr[3] = audio::to_float16(-0.25f);
+
+    XCTAssertTrue(dst_buffer.convert_from(src_buffer));
+
+    float const *const dst_ptr = dst_buffer.data_ptr_at_channel<float>(1);
+
+    XCTAssertEqual(dst_ptr[0], 0.5f);
+    XCTAssertEqual(dst_ptr[1], 0.0f);
+    XCTAssertEqual(dst_ptr[3], -0.25f);
+}
+
 - (void)test_copy_channel_float64_data_deinterleaved_to_interleaved {
     double const sample_rate = 48000.0;
     uint32_t const frame_length = 4;
@@ -936,6 +992,43 @@ using namespace yas::audio;
     }
 }
 
+- (void)test_allocate_abl_aligned_slab {
+    uint32_t const buf = 3;
+    uint32_t const size = 12;
+
+    auto const pair = audio::allocate_audio_buffer_list(buf, 1, size);
+    audio::abl_uptr const &abl = pair.first;
+    uint8_t const *const slab = pair.second.get();
+
+    XCTAssertTrue(slab != nullptr);
+    for (uint32_t i = 0; i < buf; i++) {
+        XCTAssertEqual(abl->mBuffers[i].mDataByteSize, size);
+        XCTAssertEqual(abl->mBuffers[i].mData, slab + audio::pcm_buffer::default_alignment * i);
+        XCTAssertEqual(reinterpret_cast<uintptr_t>(abl->mBuffers[i].mData) % audio::pcm_buffer::default_alignment, 0);
+    }
+}
+
+- (void)test_allocate_abl_with_alignment {
+    auto const pair = audio::allocate_audio_buffer_list(2, 1, 4, 256);
+    audio::abl_uptr const &abl = pair.first;
+
+    XCTAssertEqual(reinterpret_cast<uintptr_t>(abl->mBuffers[0].mData) % 256, 0);
+    XCTAssertEqual(reinterpret_cast<uintptr_t>(abl->mBuffers[1].mData) % 256, 0);
+
+    XCTAssertThrows(audio::allocate_audio_buffer_list(2, 1, 4, 0));
+    XCTAssertThrows(audio::allocate_audio_buffer_list(2, 1, 4, 48));
+}
+
+- (void)test_create_buffer_with_alignment {
+    audio::format const format{{.sample_rate = 48000.0, .channel_count = 2}};
+    audio::pcm_buffer buffer{format, 5, 128};
+
+    XCTAssertEqual(buffer.frame_capacity(), 5);
+    XCTAssertEqual(buffer.audio_buffer_list()->mBuffers[0].mDataByteSize, 5 * sizeof(float));
+    XCTAssertEqual(reinterpret_cast<uintptr_t>(buffer.data_ptr_at_index<float>(0)) % 128, 0);
+    XCTAssertEqual(reinterpret_cast<uintptr_t>(buffer.data_ptr_at_index<float>(1)) % 128, 0);
+}
+
 - (void)test_allocate_abl_without_data {
     uint32_t buf = 1;
     uint32_t ch_idx = 1;
@@ -1330,6 +1423,368 @@ using namespace yas::audio;
     XCTAssertFalse(buffer.is_empty());
 }
 
+- (void)test_is_silent {
+    audio::format const format{{.sample_rate = 48000.0, .channel_count = 2, .interleaved = true}};
+
+    audio::pcm_buffer buffer{format, 100};
+    float *data = buffer.data_ptr_at_index<float>(0);
+
+    XCTAssertTrue(buffer.is_silent());
+
+    data[199] = -0.001f;
+
+    XCTAssertFalse(buffer.is_silent());
+    XCTAssertFalse(buffer.is_silent(0.0005));
+    XCTAssertTrue(buffer.is_silent(0.001));
+
+    buffer.set_frame_length(99);
+
+    XCTAssertTrue(buffer.is_silent());
+}
+
+- (void)test_peak_and_rms {
+    audio::format const format{
+        {.sample_rate = 48000.0, .channel_count = 2, .pcm_format = pcm_format::int16, .interleaved = true}};
+
+    audio::pcm_buffer buffer{format, 4};
+    int16_t *data = buffer.data_ptr_at_index<int16_t>(0);
+
+    for (uint32_t frame = 0; frame < 4; ++frame) {
+        data[frame * 2] = (frame % 2) ? -16384 : 16384;
+    }
+    data[3] = -32768;
+
+    XCTAssertEqual(buffer.peak(0), 0.5);
+    XCTAssertEqual(buffer.rms(0), 0.5);
+    XCTAssertEqual(buffer.peak(1), 1.0);
+    XCTAssertEqual(buffer.rms(1), 0.5);
+
+    XCTAssertThrows((void)buffer.peak(2));
+    XCTAssertThrows((void)buffer.rms(2));
+}
+
+- (void)test_is_empty_performance {
+    audio::format const format{{.sample_rate = 48000.0, .channel_count = 2}};
+    audio::pcm_buffer buffer{format, 4096};
+
+    [self measureBlock:^{
+        for (uint32_t i = 0; i < 10000; ++i) {
+            (void)buffer.is_empty();
+        }
+    }];
+}
+
+- (void)test_is_silent_performance {
+    audio::format const format{{.sample_rate = 48000.0, .channel_count = 2}};
+    audio::pcm_buffer buffer{format, 4096};
+
+    [self measureBlock:^{
+        for (uint32_t i = 0; i < 10000; ++i) {
+            (void)buffer.is_silent(0.0001);
+        }
+    }];
+}
+
+- (void)test_copy_to_out_of_range_channel {
+    audio::format const format{{.sample_rate = 48000.0, .channel_count = 2}};
+    audio::pcm_buffer buffer{format, 4};
+    float data[4];
+
+    auto result = buffer.copy_to(data, 1, 0, 2, 0, 4);
+
+    XCTAssertFalse(result);
+    XCTAssertEqual(result.error(), audio::pcm_buffer::copy_error_t::out_of_range_channel);
+}
+
+- (void)test_convert_from {
+    audio::format const from_format{{.sample_rate = 48000.0, .channel_count = 2, .interleaved = true}};
+    audio::format const to_format{
+        {.sample_rate = 48000.0, .channel_count = 2, .pcm_format = audio::pcm_format::int16}};
+    audio::pcm_buffer from_buffer{from_format, 4};
+    audio::pcm_buffer to_buffer{to_format, 8};
+
+    float *const from_data = from_buffer.data_ptr_at_index<float>(0);
+    for (uint32_t idx = 0; idx < 8; ++idx) {
+        from_data[idx] = static_cast<float>(idx) * 0.125f;
+    }
+
+    auto result = to_buffer.convert_from(from_buffer);
+
+    XCTAssertTrue(result);
+    XCTAssertEqual(result.value(), 4);
+    XCTAssertEqual(to_buffer.frame_length(), 4);
+
+    for (uint32_t frame = 0; frame < 4; ++frame) {
+        XCTAssertEqual(to_buffer.data_ptr_at_index<int16_t>(0)[frame], frame * 2 * 4096);
+        XCTAssertEqual(to_buffer.data_ptr_at_index<int16_t>(1)[frame], (frame * 2 + 1) * 4096);
+    }
+}
+
+- (void)test_convert_from_with_options {
+    audio::format const from_format{
+        {.sample_rate = 48000.0, .channel_count = 1, .pcm_format = audio::pcm_format::int16}};
+    audio::format const to_format{
+        {.sample_rate = 48000.0, .channel_count = 1, .pcm_format = audio::pcm_format::float64}};
+    audio::pcm_buffer from_buffer{from_format, 4};
+    audio::pcm_buffer to_buffer{to_format, 4};
+
+    int16_t *const from_data = from_buffer.data_ptr_at_index<int16_t>(0);
+    for (uint32_t frame = 0; frame < 4; ++frame) {
+        from_data[frame] = static_cast<int16_t>(frame * 8192);
+    }
+
+    auto result = to_buffer.convert_from(from_buffer, {.from_begin_frame = 1, .to_begin_frame = 2, .length = 2});
+
+    XCTAssertTrue(result);
+    XCTAssertEqual(result.value(), 2);
+    XCTAssertEqual(to_buffer.frame_length(), 4);
+
+    double const *const to_data = to_buffer.data_ptr_at_index<double>(0);
+    XCTAssertEqual(to_data[0], 0.0);
+    XCTAssertEqual(to_data[1], 0.0);
+    XCTAssertEqual(to_data[2], 0.25);
+    XCTAssertEqual(to_data[3], 0.5);
+}
+
+- (void)test_convert_from_failed {
+    audio::format const format{{.sample_rate = 48000.0, .channel_count = 2}};
+    audio::format const mono_format{
+        {.sample_rate = 48000.0, .channel_count = 1, .pcm_format = audio::pcm_format::int16}};
+    audio::format const int16_format{
+        {.sample_rate = 48000.0, .channel_count = 2, .pcm_format = audio::pcm_format::int16}};
+    audio::pcm_buffer buffer{format, 4};
+    audio::pcm_buffer mono_buffer{mono_format, 4};
+    audio::pcm_buffer int16_buffer{int16_format, 4};
+
+    auto result = mono_buffer.convert_from(buffer);
+    XCTAssertFalse(result);
+    XCTAssertEqual(result.error(), audio::pcm_buffer::copy_error_t::invalid_format);
+
+    result = int16_buffer.convert_from(buffer, {.from_begin_frame = 2, .length = 3});
+    XCTAssertFalse(result);
+    XCTAssertEqual(result.error(), audio::pcm_buffer::copy_error_t::out_of_range_frame);
+
+    result = int16_buffer.convert_from(buffer, {.to_begin_frame = 2, .length = 3});
+    XCTAssertFalse(result);
+    XCTAssertEqual(result.error(), audio::pcm_buffer::copy_error_t::out_of_range_frame);
+}
+
+- (void)test_add_from {
+    audio::format const from_format{{.sample_rate = 48000.0, .channel_count = 2, .interleaved = true}};
+    audio::format const to_format{{.sample_rate = 48000.0, .channel_count = 2}};
+    audio::pcm_buffer from_buffer{from_format, 4};
+    audio::pcm_buffer to_buffer{to_format, 4};
+
+    for (uint32_t frame = 0; frame < 4; ++frame) {
+        from_buffer.data_ptr_at_index<float>(0)[frame * 2] = 1.0f;
+        from_buffer.data_ptr_at_index<float>(0)[frame * 2 + 1] = 2.0f;
+        to_buffer.data_ptr_at_channel<float>(0)[frame] = 0.5f;
+    }
+
+    auto result = to_buffer.add_from(from_buffer, 0.5);
+
+    XCTAssertTrue(result);
+    XCTAssertEqual(result.value(), 4);
+
+    for (uint32_t frame = 0; frame < 4; ++frame) {
+        XCTAssertEqual(to_buffer.data_ptr_at_channel<float>(0)[frame], 1.0f);
+        XCTAssertEqual(to_buffer.data_ptr_at_channel<float>(1)[frame], 1.0f);
+    }
+}
+
+- (void)test_add_from_with_ramp {
+    audio::format const format{
+        {.sample_rate = 48000.0, .channel_count = 2, .pcm_format = audio::pcm_format::float64, .interleaved = true}};
+    audio::pcm_buffer from_buffer{format, 4};
+    audio::pcm_buffer to_buffer{format, 4};
+
+    double *const from_data = from_buffer.data_ptr_at_index<double>(0);
+    for (uint32_t idx = 0; idx < 8; ++idx) {
+        from_data[idx] = 1.0;
+    }
+
+    XCTAssertTrue(to_buffer.add_from_with_ramp(from_buffer, 0.0, 1.0));
+
+    double const *const to_data = to_buffer.data_ptr_at_index<double>(0);
+    for (uint32_t frame = 0; frame < 4; ++frame) {
+        XCTAssertEqual(to_data[frame * 2], frame * 0.25);
+        XCTAssertEqual(to_data[frame * 2 + 1], frame * 0.25);
+    }
+}
+
+- (void)test_add_from_failed {
+    audio::format const format{{.sample_rate = 48000.0, .channel_count = 2}};
+    audio::format const int16_format{
+        {.sample_rate = 48000.0, .channel_count = 2, .pcm_format = audio::pcm_format::int16}};
+    audio::pcm_buffer buffer{format, 4};
+    audio::pcm_buffer long_buffer{format, 8};
+    audio::pcm_buffer int16_buffer{int16_format, 4};
+
+    auto result = buffer.add_from(int16_buffer);
+    XCTAssertFalse(result);
+    XCTAssertEqual(result.error(), audio::pcm_buffer::copy_error_t::invalid_format);
+
+    result = int16_buffer.add_from(int16_buffer);
+    XCTAssertFalse(result);
+    XCTAssertEqual(result.error(), audio::pcm_buffer::copy_error_t::invalid_format);
+
+    result = buffer.add_from(long_buffer);
+    XCTAssertFalse(result);
+    XCTAssertEqual(result.error(), audio::pcm_buffer::copy_error_t::out_of_range_frame);
+}
+
+- (void)test_apply_gain {
+    audio::format const format{{.sample_rate = 48000.0, .channel_count = 2}};
+    audio::pcm_buffer buffer{format, 4};
+
+    for (uint32_t ch_idx = 0; ch_idx < 2; ++ch_idx) {
+        for (uint32_t frame = 0; frame < 4; ++frame) {
+            buffer.data_ptr_at_channel<float>(ch_idx)[frame] = 2.0f;
+        }
+    }
+
+    buffer.apply_gain(0.25);
+
+    for (uint32_t ch_idx = 0; ch_idx < 2; ++ch_idx) {
+        for (uint32_t frame = 0; frame < 4; ++frame) {
+            XCTAssertEqual(buffer.data_ptr_at_channel<float>(ch_idx)[frame], 0.5f);
+        }
+    }
+}
+
+- (void)test_apply_gain_ramp {
+    audio::format const format{{.sample_rate = 48000.0, .channel_count = 2, .interleaved = true}};
+    audio::pcm_buffer buffer{format, 4};
+    float *const data = buffer.data_ptr_at_index<float>(0);
+
+    for (uint32_t idx = 0; idx < 8; ++idx) {
+        data[idx] = 1.0f;
+    }
+
+    buffer.apply_gain_ramp(1.0, 0.0);
+
+    for (uint32_t frame = 0; frame < 4; ++frame) {
+        XCTAssertEqual(data[frame * 2], 1.0f - frame * 0.25f);
+        XCTAssertEqual(data[frame * 2 + 1], 1.0f - frame * 0.25f);
+    }
+
+    audio::pcm_buffer int16_buffer{
+        audio::format{{.sample_rate = 48000.0, .channel_count = 1, .pcm_format = audio::pcm_format::int16}}, 4};
+
+    XCTAssertThrows(int16_buffer.apply_gain(0.5));
+}
+
+- (void)test_reconfigure {
+    audio::format const stereo_format{{.sample_rate = 48000.0, .channel_count = 2}};
+    audio::format const mono_format{{.sample_rate = 44100.0, .channel_count = 1}};
+    audio::pcm_buffer buffer{stereo_format, 512};
+    float const *const data = buffer.data_ptr_at_index<float>(0);
+
+    buffer.data_ptr_at_channel<float>(0)[0] = 1.0f;
+
+    buffer.reconfigure(mono_format, 256);
+
+    XCTAssertTrue(buffer.format() == mono_format);
+    XCTAssertEqual(buffer.frame_capacity(), 256);
+    XCTAssertEqual(buffer.frame_length(), 256);
+    XCTAssertEqual(buffer.audio_buffer_list()->mNumberBuffers, 1);
+    XCTAssertEqual(buffer.data_ptr_at_index<float>(0), data);
+    XCTAssertEqual(buffer.data_ptr_at_index<float>(0)[0], 0.0f);
+
+    buffer.reconfigure(stereo_format, 512);
+
+    XCTAssertEqual(buffer.audio_buffer_list()->mNumberBuffers, 2);
+    XCTAssertEqual(buffer.data_ptr_at_index<float>(0), data);
+    XCTAssertEqual(buffer.audio_buffer_list()->mBuffers[1].mDataByteSize, 512 * sizeof(float));
+}
+
+- (void)test_reconfigure_grow {
+    audio::format const format{{.sample_rate = 48000.0, .channel_count = 2}};
+    audio::format const interleaved_format{
+        {.sample_rate = 48000.0, .channel_count = 4, .pcm_format = audio::pcm_format::int16, .interleaved = true}};
+    audio::pcm_buffer buffer{format, 512};
+    float const *const data = buffer.data_ptr_at_index<float>(0);
+
+    buffer.reconfigure(format, 600);
+
+    XCTAssertEqual(buffer.frame_capacity(), 600);
+    XCTAssertNotEqual(buffer.data_ptr_at_index<float>(0), data);
+
+    float const *const grown_data = buffer.data_ptr_at_index<float>(0);
+
+    buffer.reconfigure(format, 1024);
+
+    XCTAssertEqual(buffer.data_ptr_at_index<float>(0), grown_data);
+
+    buffer.reconfigure(interleaved_format, 1000);
+
+    XCTAssertEqual(buffer.audio_buffer_list()->mNumberBuffers, 1);
+    XCTAssertEqual(buffer.audio_buffer_list()->mBuffers[0].mNumberChannels, 4);
+    XCTAssertEqual(buffer.audio_buffer_list()->mBuffers[0].mDataByteSize, 1000 * 4 * sizeof(int16_t));
+}
+
+- (void)test_reconfigure_failed {
+    audio::format const format{{.sample_rate = 48000.0, .channel_count = 2}};
+    audio::pcm_buffer buffer{format, 4};
+    audio::pcm_buffer abl_buffer{format, buffer.audio_buffer_list()};
+
+    XCTAssertThrows(buffer.reconfigure(format, 0));
+    XCTAssertThrows(abl_buffer.reconfigure(format, 4));
+}
+
+- (void)test_add_from_performance {
+    audio::format const format{{.sample_rate = 48000.0, .channel_count = 2}};
+    audio::pcm_buffer from_buffer{format, 512};
+    audio::pcm_buffer to_buffer{format, 512};
+
+    [self measureBlock:^{
+        for (uint32_t i = 0; i < 10000; ++i) {
+            to_buffer.add_from_with_ramp(from_buffer, 0.5, 1.0);
+        }
+    }];
+}
+
+- (void)test_convert_performance {
+    audio::format const from_format{
+        {.sample_rate = 48000.0, .channel_count = 2, .pcm_format = audio::pcm_format::int16, .interleaved = true}};
+    audio::format const to_format{{.sample_rate = 48000.0, .channel_count = 2}};
+    audio::pcm_buffer from_buffer{from_format, 512};
+    audio::pcm_buffer to_buffer{to_format, 512};
+
+    [self measureBlock:^{
+        for (uint32_t i = 0; i < 10000; ++i) {
+            to_buffer.convert_from(from_buffer);
+        }
+    }];
+}
+
+- (void)test_copy_same_layout_performance {
+    audio::format const format{{.sample_rate = 48000.0, .channel_count = 8}};
+    audio::pcm_buffer from_buffer{format, 512};
+    audio::pcm_buffer to_buffer{format, 512};
+    test::fill_test_values_to_buffer(from_buffer);
+
+    [self measureBlock:^{
+        for (uint32_t i = 0; i < 10000; ++i) {
+            to_buffer.copy_from(from_buffer);
+        }
+    }];
+}
+
+- (void)test_copy_different_layout_performance {
+    audio::format const from_format{{.sample_rate = 48000.0, .channel_count = 8, .interleaved = true}};
+    audio::format const to_format{{.sample_rate = 48000.0, .channel_count = 8}};
+    audio::pcm_buffer from_buffer{from_format, 512};
+    audio::pcm_buffer to_buffer{to_format, 512};
+    test::fill_test_values_to_buffer(from_buffer);
+
+    [self measureBlock:^{
+        for (uint32_t i = 0; i < 10000; ++i) {
+            to_buffer.copy_from(from_buffer);
+        }
+    }];
+}
+
 #pragma mark -
 
 - (void)assert_buffer_with_channel_map:(audio::channel_map_t const &)channel_map
@@ -2,6 +2,7 @@
 //  yas_audio_graph_tests.m
 //
 
+#import "yas_audio_test_io_device.h"
 #import "yas_audio_test_utils.h"
 
 using namespace yas;
@@ -12,6 +13,8 @@ struct test_io_core : io_core {
     }
     void set_maximum_frames_per_slice(uint32_t const) override {
     }
+    void set_memory_policy(audio::memory_policy const) override {
+    }
 
     bool start() override {
         return false;
@@ -136,6 +139,187 @@ struct test_io_device : io_device {
     XCTAssertNoThrow(graph->remove_io());
 }
 
+- (void)test_buffer_pool {
+    auto graph = audio::graph::make_shared();
+
+    XCTAssertTrue(graph->buffer_pool() != nullptr);
+    XCTAssertEqual(graph->buffer_pool()->usages().size(), 0);
+}
+
+- (void)test_reserve_slot_buffers_in_pool {
+    audio::format const format{{.sample_rate = 48000.0, .channel_count = 1}};
+
+    auto const device = test::test_io_device::make_shared();
+    auto const core = std::make_shared<test::test_io_core>();
+
+    device->make_io_core_handler = [core]() { return core; };
+    device->output_format_handler = [format]() { return format; };
+    core->start_handler = [] { return true; };
+
+    auto const graph = audio::graph::make_shared();
+    auto const &graph_io = graph->add_io(device);
+    auto const pool = graph->buffer_pool();
+
+    XCTAssertTrue(graph_io->buffer_pool() == pool);
+
+    test::node_object source_obj(0, 1);
+    test::node_object effect_obj(1, 1, true);
+
+    graph->connect(source_obj.node, effect_obj.node, format);
+    graph->connect(effect_obj.node, graph_io->output_node, format);
+
+    XCTAssertEqual(pool->usages().size(), 0);
+
+    XCTAssertTrue(graph->start_render());
+
+    uint32_t const frame_capacity = graph_io->raw_io()->maximum_frames_per_slice();
+    auto const key = pool->key(format, frame_capacity);
+
+    // the output node pulls the effect into the io buffer, so only the source gets a slot
+    XCTAssertTrue(key);
+    XCTAssertEqual(pool->usages().at(*key).buffer_count, 1);
+    XCTAssertTrue(graph_io->rendering_graph_holder()->graph()->buffer_pool() == pool);
+
+    test::node_object other_obj(0, 1);
+
+    graph->disconnect(source_obj.node);
+
+    XCTAssertEqual(pool->usages().at(*key).buffer_count, 0);
+
+    graph->connect(other_obj.node, effect_obj.node, format);
+
+    XCTAssertEqual(pool->key(format, frame_capacity), key);
+    XCTAssertEqual(pool->usages().at(*key).buffer_count, 1);
+
+    graph->stop();
+
+    XCTAssertEqual(pool->usages().at(*key).buffer_count, 0);
+}
+
+- (void)test_rebuild_rendering_when_maximum_frames_changed {
+    audio::format const format{{.sample_rate = 48000.0, .channel_count = 1}};
+
+    auto const device = test::test_io_device::make_shared();
+    auto const core = std::make_shared<test::test_io_core>();
+
+    device->make_io_core_handler = [core]() { return core; };
+    device->output_format_handler = [format]() { return format; };
+    core->start_handler = [] { return true; };
+
+    auto const graph = audio::graph::make_shared();
+    auto const &graph_io = graph->add_io(device);
+    auto const pool = graph->buffer_pool();
+
+    test::node_object source_obj(0, 1);
+    test::node_object effect_obj(1, 1, true);
+
+    graph->connect(source_obj.node, effect_obj.node, format);
+    graph->connect(effect_obj.node, graph_io->output_node, format);
+
+    XCTAssertTrue(graph->start_render());
+
+    auto const &holder = graph_io->rendering_graph_holder();
+    auto previous_graph = holder->graph();
+    uint32_t const previous_frames = graph_io->raw_io()->maximum_frames_per_slice();
+
+    graph_io->raw_io()->set_maximum_frames_per_slice(previous_frames);
+
+    XCTAssertTrue(holder->graph() == previous_graph);
+
+    uint32_t const frames = previous_frames * 2;
+
+    graph_io->raw_io()->set_maximum_frames_per_slice(frames);
+
+    XCTAssertTrue(holder->graph() != previous_graph);
+
+    auto const previous_key = pool->key(format, previous_frames);
+    auto const key = pool->key(format, frames);
+
+    XCTAssertTrue(previous_key);
+    XCTAssertTrue(key);
+
+    previous_graph = nullptr;
+
+    XCTAssertEqual(pool->usages().at(*previous_key).buffer_count, 0);
+    XCTAssertEqual(pool->usages().at(*key).buffer_count, 1);
+
+    graph->stop();
+}
+
+- (void)test_render_with_buffer_pool {
+    audio::format const format{{.sample_rate = 48000.0, .channel_count = 1}};
+    audio::format const scratch_format{{.sample_rate = 48000.0, .channel_count = 2}};
+
+    auto const device = test::test_io_device::make_shared();
+    auto const core = std::make_shared<test::test_io_core>();
+
+    std::optional<audio::io_render_f> render_handler = std::nullopt;
+
+    device->make_io_core_handler = [core]() { return core; };
+    device->output_format_handler = [format]() { return format; };
+    core->set_render_handler_handler = [&render_handler](std::optional<audio::io_render_f> const &handler) {
+        render_handler = handler;
+    };
+    core->start_handler = [] { return true; };
+
+    auto const graph = audio::graph::make_shared();
+    auto const &graph_io = graph->add_io(device);
+    auto const &pool = graph->buffer_pool();
+
+    uint32_t const frame_capacity = graph_io->raw_io()->maximum_frames_per_slice();
+    auto const scratch_key = pool->reserve(scratch_format, frame_capacity);
+
+    test::node_object source_obj(0, 1);
+
+    bool is_acquired = false;
+
+    source_obj.node->set_render_handler([pool, scratch_key, &is_acquired](audio::node_render_args const &args) {
+        audio::pcm_buffer *const scratch = pool->acquire(scratch_key);
+
+        if (!scratch) {
+            return;
+        }
+
+        is_acquired = true;
+
+        auto *const scratch_data = scratch->data_ptr_at_index<float>(0);
+        auto *const data = args.buffer->data_ptr_at_index<float>(0);
+        for (uint32_t frame = 0; frame < args.buffer->frame_length(); ++frame) {
+            scratch_data[frame] = 0.5f;
+            data[frame] = scratch_data[frame];
+        }
+
+        pool->release(scratch_key, scratch);
+    });
+
+    graph->connect(source_obj.node, graph_io->output_node, format);
+
+    XCTAssertTrue(graph->start_render());
+    XCTAssertTrue(render_handler);
+
+    audio::pcm_buffer buffer{format, frame_capacity};
+    buffer.set_frame_length(4);
+    std::optional<audio::time> const output_time = audio::time{0, format.sample_rate()};
+    std::optional<audio::time> const input_time = std::nullopt;
+
+    render_handler.value()(
+        {.output_buffer = &buffer, .output_time = output_time, .input_buffer = nullptr, .input_time = input_time});
+
+    XCTAssertTrue(is_acquired);
+    XCTAssertEqual(buffer.data_ptr_at_index<float>(0)[3], 0.5f);
+    XCTAssertEqual(pool->usages().at(scratch_key).high_water_mark, 1);
+
+    audio::pcm_buffer *const scratch = pool->acquire(scratch_key);
+    XCTAssertTrue(scratch != nullptr);
+    pool->release(scratch_key, scratch);
+
+    graph->stop();
+
+    XCTAssertEqual(pool->usages().at(scratch_key).buffer_count, 1);
+
+    pool->unreserve(scratch_key);
+}
+
 - (void)test_start_error_to_string {
     XCTAssertEqual(to_string(audio::graph::start_error_t::already_running), "already_running");
     XCTAssertEqual(to_string(audio::graph::start_error_t::prepare_failure), "prepare_failure");
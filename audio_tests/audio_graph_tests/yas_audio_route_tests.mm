@@ -127,4 +127,52 @@ using namespace yas;
     }
 }
 
+- (void)test_route_table {
+    audio::route_set_t routes{{0, 0, 0, 1}, {0, 1, 1, 0}, {1, 0, 0, 0}, {1, 2, 0, 1}};
+
+    audio::route_table const table{routes, {{0, 2}, {1, 3}}, {{0, 2}, {1, 1}}};
+
+    auto const *map_0_0 = table.channel_map(0, 2, 0, 2);
+    XCTAssertTrue(map_0_0 != nullptr);
+    if (map_0_0) {
+        XCTAssertEqual(map_0_0[0], 1);
+        XCTAssertEqual(map_0_0[1], -1);
+    }
+
+    auto const *map_0_1 = table.channel_map(0, 2, 1, 1);
+    XCTAssertTrue(map_0_1 != nullptr);
+    if (map_0_1) {
+        XCTAssertEqual(map_0_1[0], -1);
+        XCTAssertEqual(map_0_1[1], 0);
+    }
+
+    auto const *map_1_0 = table.channel_map(1, 3, 0, 2);
+    XCTAssertTrue(map_1_0 != nullptr);
+    if (map_1_0) {
+        XCTAssertEqual(map_1_0[0], 0);
+        XCTAssertEqual(map_1_0[1], -1);
+        XCTAssertEqual(map_1_0[2], 1);
+    }
+
+    XCTAssertTrue(table.channel_map(1, 3, 1, 1) == nullptr);
+}
+
+- (void)test_route_table_mismatched_channel_count {
+    audio::route_set_t routes{{0, 0, 0, 0}};
+
+    audio::route_table const table{routes, {{0, 1}}, {{0, 1}}};
+
+    XCTAssertTrue(table.channel_map(0, 1, 0, 1) != nullptr);
+    XCTAssertTrue(table.channel_map(0, 2, 0, 1) == nullptr);
+    XCTAssertTrue(table.channel_map(0, 1, 0, 2) == nullptr);
+    XCTAssertTrue(table.channel_map(1, 1, 0, 1) == nullptr);
+    XCTAssertTrue(table.channel_map(0, 1, 1, 1) == nullptr);
+}
+
+- (void)test_route_table_empty {
+    audio::route_table const table;
+
+    XCTAssertTrue(table.channel_map(0, 1, 0, 1) == nullptr);
+}
+
 @end
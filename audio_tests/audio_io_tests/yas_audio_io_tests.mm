@@ -112,4 +112,29 @@ using namespace yas::audio;
     XCTAssertEqual(called_methods.at(7), method::stop);
 }
 
+- (void)test_memory_policy {
+    auto const device = std::make_shared<test::test_io_device>();
+
+    auto const core = std::make_shared<test::test_io_core>();
+    device->make_io_core_handler = [core]() { return core; };
+
+    std::vector<audio::memory_policy> received;
+
+    core->set_memory_policy_handler = [&received](audio::memory_policy const policy) {
+        received.emplace_back(policy);
+    };
+
+    auto const io = audio::io::make_shared(device);
+
+    XCTAssertEqual(io->memory_policy(), audio::memory_policy::standard);
+    XCTAssertEqual(received.size(), 1);
+    XCTAssertEqual(received.at(0), audio::memory_policy::standard);
+
+    io->set_memory_policy(audio::memory_policy::locked);
+
+    XCTAssertEqual(io->memory_policy(), audio::memory_policy::locked);
+    XCTAssertEqual(received.size(), 2);
+    XCTAssertEqual(received.at(1), audio::memory_policy::locked);
+}
+
 @end
@@ -0,0 +1,170 @@
+//
+//  yas_audio_rendering_graph_holder_tests.mm
+//
+
+#import <XCTest/XCTest.h>
+#import "yas_audio_test_io_device.h"
+#import "yas_audio_test_utils.h"
+
+using namespace yas;
+
+@interface yas_audio_rendering_graph_holder_tests : XCTestCase
+
+@end
+
+@implementation yas_audio_rendering_graph_holder_tests
+
+- (void)test_set_graph {
+    test::node_object output_obj(1, 0);
+    test::node_object input_obj(0, 1);
+
+    auto const holder = audio::rendering_graph_holder::make_shared();
+
+    XCTAssertFalse(holder->graph());
+
+    {
+        audio::rendering_graph_holder::reading const reading{*holder};
+        XCTAssertTrue(reading.graph() == nullptr);
+    }
+
+    auto const graph = std::make_shared<audio::rendering_graph>(output_obj.node, input_obj.node, 512);
+
+    holder->set_graph(graph);
+
+    XCTAssertEqual(holder->graph(), graph);
+    XCTAssertEqual(holder->retired_count(), 0);
+
+    {
+        audio::rendering_graph_holder::reading const reading{*holder};
+        XCTAssertTrue(reading.graph() == graph.get());
+    }
+
+    XCTAssertThrows(audio::rendering_graph_holder::make_shared(-1.0));
+}
+
+- (void)test_retire_after_reading {
+    test::node_object output_obj(1, 0);
+    test::node_object input_obj(0, 1);
+
+    auto const holder = audio::rendering_graph_holder::make_shared(0.0);
+
+    auto graph1 = std::make_shared<audio::rendering_graph>(output_obj.node, input_obj.node, 512);
+    std::weak_ptr<audio::rendering_graph> const weak_graph1 = graph1;
+
+    holder->set_graph(graph1);
+    graph1 = nullptr;
+
+    auto const graph2 = std::make_shared<audio::rendering_graph>(output_obj.node, input_obj.node, 512);
+
+    {
+        audio::rendering_graph_holder::reading const reading{*holder};
+
+        holder->set_graph(graph2);
+
+        XCTAssertEqual(holder->retired_count(), 1);
+        XCTAssertFalse(weak_graph1.expired());
+        XCTAssertTrue(reading.graph() == weak_graph1.lock().get());
+    }
+
+    {
+        audio::rendering_graph_holder::reading const reading{*holder};
+
+        XCTAssertTrue(reading.graph() == graph2.get());
+
+        holder->reclaim();
+
+        XCTAssertEqual(holder->retired_count(), 0);
+        XCTAssertTrue(weak_graph1.expired());
+    }
+}
+
+- (void)test_reclaim_after_grace_period {
+    test::node_object output_obj(1, 0);
+    test::node_object input_obj(0, 1);
+
+    auto const holder = audio::rendering_graph_holder::make_shared(0.01);
+
+    auto graph = std::make_shared<audio::rendering_graph>(output_obj.node, input_obj.node, 512);
+    std::weak_ptr<audio::rendering_graph> const weak_graph = graph;
+
+    holder->set_graph(graph);
+    graph = nullptr;
+
+    {
+        audio::rendering_graph_holder::reading const reading{*holder};
+        holder->set_graph(nullptr);
+    }
+
+    XCTAssertEqual(holder->retired_count(), 1);
+
+    [[NSRunLoop mainRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:0.1]];
+
+    XCTAssertEqual(holder->retired_count(), 0);
+    XCTAssertTrue(weak_graph.expired());
+}
+
+- (void)test_update_rendering_without_restarting {
+    audio::format const format{{.sample_rate = 48000.0, .channel_count = 1}};
+
+    auto const device = test::test_io_device::make_shared();
+    auto const core = std::make_shared<test::test_io_core>();
+
+    device->make_io_core_handler = [core]() { return core; };
+    device->output_format_handler = [format]() { return format; };
+
+    std::size_t handler_set_count = 0;
+    std::optional<audio::io_render_f> render_handler = std::nullopt;
+
+    core->set_render_handler_handler = [&handler_set_count,
+                                        &render_handler](std::optional<audio::io_render_f> const &handler) {
+        ++handler_set_count;
+        render_handler = handler;
+    };
+    core->start_handler = [] { return true; };
+
+    auto const graph = audio::graph::make_shared();
+    auto const &graph_io = graph->add_io(device);
+
+    handler_set_count = 0;
+
+    XCTAssertTrue(graph->start_render());
+    XCTAssertEqual(handler_set_count, 1);
+    XCTAssertTrue(render_handler);
+
+    auto const &holder = graph_io->rendering_graph_holder();
+    auto const prev_graph = holder->graph();
+
+    XCTAssertTrue(prev_graph);
+
+    test::node_object source_obj(0, 1);
+
+    source_obj.node->set_render_handler([](audio::node_render_args const &args) {
+        auto *const data = args.buffer->data_ptr_at_index<float>(0);
+        for (uint32_t frame = 0; frame < args.buffer->frame_length(); ++frame) {
+            data[frame] = 1.0f;
+        }
+    });
+
+    graph->connect(source_obj.node, graph_io->output_node, format);
+
+    XCTAssertEqual(handler_set_count, 1);
+    XCTAssertTrue(holder->graph());
+    XCTAssertNotEqual(holder->graph(), prev_graph);
+
+    audio::pcm_buffer buffer{format, 4};
+    std::optional<audio::time> const output_time = audio::time{0, format.sample_rate()};
+    std::optional<audio::time> const input_time = std::nullopt;
+
+    render_handler.value()(
+        {.output_buffer = &buffer, .output_time = output_time, .input_buffer = nullptr, .input_time = input_time});
+
+    XCTAssertEqual(buffer.data_ptr_at_index<float>(0)[3], 1.0f);
+
+    graph->disconnect(source_obj.node);
+
+    XCTAssertEqual(handler_set_count, 1);
+
+    graph->stop();
+}
+
+@end
@@ -110,7 +110,7 @@ using namespace yas;
     auto const connection_1 = graph->connect(source_obj_1.node, destination_obj.node, format_1);
     auto const connection_2 = graph->connect(input_source_obj.node, input_dst_node->node, format_2);
 
-    audio::rendering_graph rendering_graph{output_obj.node, input_source_obj.node};
+    audio::rendering_graph rendering_graph{output_obj.node, input_source_obj.node, 512};
 
     {
         XCTAssertTrue(rendering_graph.output_node() != nullptr);
@@ -145,14 +145,296 @@ using namespace yas;
     }
 }
 
+- (void)test_rendering_graph_shared_source {
+    auto graph = audio::graph::make_shared();
+
+    audio::format format{{.sample_rate = 48000.0, .channel_count = 1}};
+
+    test::node_object source_obj(0, 1);
+    test::node_object splitter_obj(1, 2, true);
+    test::node_object mixer_obj(2, 1, true);
+    test::node_object output_obj(1, 0);
+    test::node_object input_obj(0, 1);
+
+    std::size_t source_called = 0;
+    std::size_t splitter_called = 0;
+
+    source_obj.node->set_render_handler([&source_called](audio::node_render_args const &args) {
+        ++source_called;
+
+        auto *const data = args.buffer->data_ptr_at_index<float>(0);
+        for (uint32_t frame = 0; frame < args.buffer->frame_length(); ++frame) {
+            data[frame] = static_cast<float>(source_called);
+        }
+    });
+
+    splitter_obj.node->set_render_handler([&splitter_called](audio::node_render_args const &args) {
+        ++splitter_called;
+
+        args.source_connections.at(0).render(args.buffer, args.time);
+
+        auto *const data = args.buffer->data_ptr_at_index<float>(0);
+        for (uint32_t frame = 0; frame < args.buffer->frame_length(); ++frame) {
+            data[frame] *= static_cast<float>(args.bus_idx + 1);
+        }
+    });
+
+    mixer_obj.node->set_render_handler([](audio::node_render_args const &args) {
+        audio::pcm_buffer src_buffer{args.buffer->format(), args.buffer->frame_length()};
+
+        args.buffer->clear();
+
+        for (auto const &pair : args.source_connections) {
+            pair.second.render(&src_buffer, args.time);
+            args.buffer->add_from(src_buffer);
+        }
+    });
+
+    graph->connect(source_obj.node, splitter_obj.node, format);
+    graph->connect(splitter_obj.node, mixer_obj.node, 0, 0, format);
+    graph->connect(splitter_obj.node, mixer_obj.node, 1, 1, format);
+    graph->connect(mixer_obj.node, output_obj.node, format);
+
+    audio::rendering_graph rendering_graph{output_obj.node, input_obj.node, 512};
+
+    auto const &source_nodes = rendering_graph.output_node()->source_nodes;
+
+    XCTAssertEqual(source_nodes.size(), 3);
+
+    auto const &steps = rendering_graph.output_node()->plan->steps;
+
+    XCTAssertEqual(steps.size(), 3);
+    XCTAssertEqual(steps.at(0).node, source_nodes.at(2).get());
+    XCTAssertEqual(steps.at(0).bus_idx, 0);
+    XCTAssertEqual(steps.at(1).node, source_nodes.at(1).get());
+    XCTAssertEqual(steps.at(1).bus_idx, 0);
+    XCTAssertEqual(steps.at(2).node, source_nodes.at(1).get());
+    XCTAssertEqual(steps.at(2).bus_idx, 1);
+    XCTAssertEqual(source_nodes.at(0)->source_connections.at(0).source_slot, steps.at(1).slot);
+    XCTAssertEqual(source_nodes.at(0)->source_connections.at(1).source_slot, steps.at(2).slot);
+
+    audio::pcm_buffer buffer{format, 512};
+
+    for (uint32_t cycle = 0; cycle < 3; ++cycle) {
+        audio::time const time{static_cast<int64_t>(cycle * 512), format.sample_rate()};
+
+        XCTAssertTrue(rendering_graph.output_node()->render(&buffer, time));
+
+        XCTAssertEqual(source_called, cycle + 1);
+        XCTAssertEqual(splitter_called, (cycle + 1) * 2);
+        XCTAssertEqual(buffer.data_ptr_at_index<float>(0)[0], static_cast<float>((cycle + 1) * 3));
+    }
+}
+
+- (void)test_rendering_graph_pulled_source {
+    auto graph = audio::graph::make_shared();
+
+    audio::format format{{.sample_rate = 48000.0, .channel_count = 1}};
+
+    test::node_object source_obj(0, 1);
+    test::node_object effect_obj(1, 1, true);
+    test::node_object converter_obj(1, 1);
+    test::node_object output_obj(1, 0);
+    test::node_object input_obj(0, 1);
+
+    std::size_t source_called = 0;
+    std::size_t effect_called = 0;
+
+    source_obj.node->set_render_handler([&source_called](audio::node_render_args const &args) {
+        ++source_called;
+
+        auto *const data = args.buffer->data_ptr_at_index<float>(0);
+        for (uint32_t frame = 0; frame < args.buffer->frame_length(); ++frame) {
+            data[frame] = static_cast<float>(source_called);
+        }
+    });
+
+    effect_obj.node->set_render_handler([&effect_called](audio::node_render_args const &args) {
+        ++effect_called;
+
+        args.source_connections.at(0).render(args.buffer, args.time);
+    });
+
+    // pulls its input twice with the same frame length and time, then once more with the next time
+    converter_obj.node->set_render_handler([](audio::node_render_args const &args) {
+        uint32_t const half_length = args.buffer->frame_length() / 2;
+        audio::pcm_buffer src_buffer{args.buffer->format(), half_length};
+        auto const &connection = args.source_connections.at(0);
+
+        args.buffer->clear();
+
+        connection.render(&src_buffer, args.time);
+        connection.render(&src_buffer, args.time);
+        args.buffer->copy_from(src_buffer, {.to_begin_frame = 0, .length = half_length});
+
+        audio::time const next_time{args.time.sample_time() + half_length, args.time.sample_rate()};
+        connection.render(&src_buffer, next_time);
+        args.buffer->copy_from(src_buffer, {.to_begin_frame = half_length, .length = half_length});
+    });
+
+    graph->connect(source_obj.node, effect_obj.node, format);
+    graph->connect(effect_obj.node, converter_obj.node, format);
+    graph->connect(converter_obj.node, output_obj.node, format);
+
+    audio::rendering_graph rendering_graph{output_obj.node, input_obj.node, 512};
+
+    auto const &source_nodes = rendering_graph.output_node()->source_nodes;
+
+    XCTAssertEqual(source_nodes.size(), 3);
+    // the effect opts in to prerendering, but it is pulled by the converter, so its source is pulled too
+    XCTAssertFalse(source_nodes.at(0)->source_connections.at(0).is_prerendered);
+    XCTAssertFalse(source_nodes.at(1)->source_connections.at(0).is_prerendered);
+    XCTAssertEqual(source_nodes.at(0)->source_connections.at(0).source_slot, nullptr);
+    XCTAssertEqual(source_nodes.at(1)->source_connections.at(0).source_slot, nullptr);
+
+    auto const &steps = rendering_graph.output_node()->plan->steps;
+
+    XCTAssertEqual(steps.size(), 0);
+
+    audio::pcm_buffer buffer{format, 512};
+
+    for (uint32_t cycle = 0; cycle < 3; ++cycle) {
+        audio::time const time{static_cast<int64_t>(cycle * 512), format.sample_rate()};
+
+        XCTAssertTrue(rendering_graph.output_node()->render(&buffer, time));
+
+        // a source with a single consumer is rendered on every pull, as with recursive rendering
+        XCTAssertEqual(source_called, (cycle + 1) * 3);
+        XCTAssertEqual(effect_called, (cycle + 1) * 3);
+        XCTAssertEqual(buffer.data_ptr_at_index<float>(0)[0], static_cast<float>(cycle * 3 + 2));
+        XCTAssertEqual(buffer.data_ptr_at_index<float>(0)[511], static_cast<float>(cycle * 3 + 3));
+    }
+}
+
+- (void)test_rendering_graph_prerendered_source_pulled_twice {
+    auto graph = audio::graph::make_shared();
+
+    audio::format format{{.sample_rate = 48000.0, .channel_count = 1}};
+
+    test::node_object source_obj(0, 1);
+    test::node_object effect_obj(1, 1, true);
+    test::node_object output_obj(1, 0);
+    test::node_object input_obj(0, 1);
+
+    std::size_t source_called = 0;
+
+    source_obj.node->set_render_handler([&source_called](audio::node_render_args const &args) {
+        ++source_called;
+
+        auto *const data = args.buffer->data_ptr_at_index<float>(0);
+        for (uint32_t frame = 0; frame < args.buffer->frame_length(); ++frame) {
+            data[frame] = static_cast<float>(source_called);
+        }
+    });
+
+    // pulls its input twice with the same frame length and time, then once at the next time
+    effect_obj.node->set_render_handler([](audio::node_render_args const &args) {
+        auto const &connection = args.source_connections.at(0);
+        audio::pcm_buffer src_buffer{args.buffer->format(), args.buffer->frame_length()};
+
+        connection.render(args.buffer, args.time);
+        connection.render(&src_buffer, args.time);
+        args.buffer->add_from(src_buffer);
+
+        audio::time const next_time{args.time.sample_time() + args.buffer->frame_length(), args.time.sample_rate()};
+        connection.render(&src_buffer, next_time);
+        args.buffer->add_from(src_buffer);
+    });
+
+    graph->connect(source_obj.node, effect_obj.node, format);
+    graph->connect(effect_obj.node, output_obj.node, format);
+
+    audio::rendering_graph rendering_graph{output_obj.node, input_obj.node, 512};
+
+    auto const &source_nodes = rendering_graph.output_node()->source_nodes;
+
+    XCTAssertTrue(source_nodes.at(0)->source_connections.at(0).is_prerendered);
+    XCTAssertEqual(rendering_graph.output_node()->plan->steps.size(), 1);
+
+    audio::pcm_buffer buffer{format, 512};
+
+    for (uint32_t cycle = 0; cycle < 3; ++cycle) {
+        audio::time const time{static_cast<int64_t>(cycle * 512), format.sample_rate()};
+
+        XCTAssertTrue(rendering_graph.output_node()->render(&buffer, time));
+
+        // the step renders once and the pull with the same time gets the copy. the pull at the next time renders
+        float const rendered = static_cast<float>(cycle * 2 + 1);
+        XCTAssertEqual(source_called, (cycle + 1) * 2);
+        XCTAssertEqual(buffer.data_ptr_at_index<float>(0)[0], rendered * 2.0f + (rendered + 1.0f));
+    }
+}
+
 - (void)test_rendering_graph_empty {
     test::node_object output_obj{1, 0};
     test::node_object input_obj{0, 1};
 
-    audio::rendering_graph rendering_graph{output_obj.node, input_obj.node};
+    audio::rendering_graph rendering_graph{output_obj.node, input_obj.node, 512};
 
     XCTAssertFalse(rendering_graph.output_node());
     XCTAssertFalse(rendering_graph.input_node());
 }
 
+- (void)test_rebuild_rendering_graph_incrementally {
+    auto graph = audio::graph::make_shared();
+
+    audio::format format{{.sample_rate = 48000.0, .channel_count = 1}};
+
+    test::node_object source_obj_0{0, 1};
+    test::node_object source_obj_1{0, 1};
+    test::node_object mixer_obj{2, 1, true};
+    test::node_object output_obj{1, 0};
+    test::node_object input_obj{0, 1};
+
+    std::size_t source_prepared = 0;
+    std::size_t mixer_prepared = 0;
+
+    audio::manageable_graph_node::cast(source_obj_0.node)->set_prepare_rendering_handler([&source_prepared] {
+        ++source_prepared;
+    });
+    audio::manageable_graph_node::cast(mixer_obj.node)->set_prepare_rendering_handler([&mixer_prepared] {
+        ++mixer_prepared;
+    });
+
+    graph->connect(source_obj_0.node, mixer_obj.node, 0, 0, format);
+    graph->connect(mixer_obj.node, output_obj.node, format);
+
+    audio::rendering_graph const graph1{output_obj.node, input_obj.node, 512};
+
+    XCTAssertEqual(graph1.build_info().node_count, 2);
+    XCTAssertEqual(graph1.build_info().rebuilt_node_count, 2);
+    XCTAssertEqual(source_prepared, 1);
+    XCTAssertEqual(mixer_prepared, 1);
+
+    graph->connect(source_obj_1.node, mixer_obj.node, 0, 1, format);
+
+    audio::rendering_graph const graph2{
+        output_obj.node, input_obj.node, 512, nullptr, graph1, {source_obj_1.node.get(), mixer_obj.node.get()}};
+
+    auto const &source_nodes1 = graph1.output_node()->source_nodes;
+    auto const &source_nodes2 = graph2.output_node()->source_nodes;
+
+    XCTAssertEqual(graph2.build_info().node_count, 3);
+    XCTAssertEqual(graph2.build_info().rebuilt_node_count, 2);
+    XCTAssertEqual(source_prepared, 1);
+    XCTAssertEqual(mixer_prepared, 2);
+    XCTAssertEqual(source_nodes2.size(), 3);
+    XCTAssertEqual(source_nodes2.at(1).get(), source_nodes1.at(1).get());
+    XCTAssertNotEqual(source_nodes2.at(0).get(), source_nodes1.at(0).get());
+    XCTAssertEqual(source_nodes2.at(0)->source_connections.at(0).source_slot,
+                   source_nodes1.at(0)->source_connections.at(0).source_slot);
+
+    audio::rendering_graph const graph3{output_obj.node, input_obj.node, 512, nullptr, graph2, {}};
+
+    XCTAssertEqual(graph3.build_info().node_count, 3);
+    XCTAssertEqual(graph3.build_info().rebuilt_node_count, 0);
+    XCTAssertEqual(graph3.output_node()->source_nodes.at(0).get(), source_nodes2.at(0).get());
+
+    audio::rendering_graph const graph4{output_obj.node, input_obj.node, 256, nullptr, graph3, {}};
+
+    XCTAssertEqual(graph4.build_info().rebuilt_node_count, 1);
+    XCTAssertEqual(source_prepared, 1);
+    XCTAssertEqual(mixer_prepared, 2);
+}
+
 @end
@@ -0,0 +1,186 @@
+//
+//  yas_audio_rendering_worker_pool_tests.mm
+//
+
+#import <XCTest/XCTest.h>
+#import "yas_audio_test_utils.h"
+
+using namespace yas;
+
+@interface yas_audio_rendering_worker_pool_tests : XCTestCase
+
+@end
+
+@implementation yas_audio_rendering_worker_pool_tests
+
+- (void)test_run {
+    auto const pool = audio::rendering_worker_pool::make_shared(3);
+
+    XCTAssertEqual(pool->worker_count(), 3);
+
+    std::vector<std::atomic<std::size_t>> called(64);
+    audio::rendering_worker_pool::task_f const task = [&called](std::size_t const idx) { called.at(idx) += 1; };
+
+    std::size_t expected = 0;
+
+    for (std::size_t run_idx = 0; run_idx < 1000; ++run_idx) {
+        std::size_t const task_count = run_idx % called.size() + 1;
+        pool->run(task_count, task);
+        expected += task_count;
+    }
+
+    std::size_t total = 0;
+    for (auto const &count : called) {
+        total += count;
+    }
+
+    XCTAssertEqual(total, expected);
+}
+
+- (void)test_run_without_workers {
+    auto const pool = audio::rendering_worker_pool::make_shared(0);
+    auto const thread_id = std::this_thread::get_id();
+
+    std::size_t called = 0;
+
+    pool->run(4, [&called, &thread_id](std::size_t const idx) {
+        XCTAssertEqual(std::this_thread::get_id(), thread_id);
+        ++called;
+    });
+
+    XCTAssertEqual(called, 4);
+}
+
+- (void)test_render_graph_in_parallel {
+    auto graph = audio::graph::make_shared();
+
+    audio::format format{{.sample_rate = 48000.0, .channel_count = 1}};
+    std::size_t const voice_count = 16;
+
+    test::node_object mixer_obj(voice_count, 1, true);
+    test::node_object output_obj(1, 0);
+    test::node_object input_obj(0, 1);
+    std::vector<test::node_object> voice_objs;
+
+    mixer_obj.node->set_render_handler([](audio::node_render_args const &args) {
+        audio::pcm_buffer src_buffer{args.buffer->format(), args.buffer->frame_length()};
+
+        for (auto const &pair : args.source_connections) {
+            pair.second.render(&src_buffer, args.time);
+            args.buffer->add_from(src_buffer);
+        }
+    });
+
+    for (std::size_t idx = 0; idx < voice_count; ++idx) {
+        auto &voice_obj = voice_objs.emplace_back(0, 1);
+
+        voice_obj.node->set_render_handler([idx](audio::node_render_args const &args) {
+            auto *const data = args.buffer->data_ptr_at_index<float>(0);
+            for (uint32_t frame = 0; frame < args.buffer->frame_length(); ++frame) {
+                data[frame] = std::sin(static_cast<float>(frame + args.time.sample_time()) * 0.01f * (idx + 1));
+            }
+        });
+
+        graph->connect(voice_obj.node, mixer_obj.node, 0, static_cast<uint32_t>(idx), format);
+    }
+
+    graph->connect(mixer_obj.node, output_obj.node, format);
+
+    audio::rendering_graph serial_graph{output_obj.node, input_obj.node, 512};
+    audio::rendering_graph parallel_graph{output_obj.node, input_obj.node, 512,
+                                          audio::rendering_worker_pool::make_shared(3)};
+
+    auto const &plan = *parallel_graph.output_node()->plan;
+
+    XCTAssertEqual(plan.steps.size(), voice_count);
+    XCTAssertEqual(plan.tasks.size(), voice_count);
+    XCTAssertEqual(plan.level_offsets.size(), 2);
+
+    audio::pcm_buffer serial_buffer{format, 512};
+    audio::pcm_buffer parallel_buffer{format, 512};
+
+    for (uint32_t cycle = 0; cycle < 10; ++cycle) {
+        audio::time const time{static_cast<int64_t>(cycle * 512), format.sample_rate()};
+
+        serial_buffer.clear();
+        parallel_buffer.clear();
+
+        XCTAssertTrue(serial_graph.output_node()->render(&serial_buffer, time));
+        XCTAssertTrue(parallel_graph.output_node()->render(&parallel_buffer, time));
+
+        XCTAssertTrue(test::is_equal_buffer_flexibly(serial_buffer, parallel_buffer));
+    }
+}
+
+- (void)test_render_nodes_pulling_shared_node_in_one_task {
+    auto graph = audio::graph::make_shared();
+
+    audio::format format{{.sample_rate = 48000.0, .channel_count = 1}};
+
+    test::node_object shared_obj(0, 2);
+    test::node_object effect_obj_0(1, 1);
+    test::node_object effect_obj_1(1, 1);
+    test::node_object voice_obj(0, 1);
+    test::node_object mixer_obj(3, 1, true);
+    test::node_object output_obj(1, 0);
+    test::node_object input_obj(0, 1);
+
+    std::size_t shared_called = 0;
+
+    shared_obj.node->set_render_handler([&shared_called](audio::node_render_args const &args) {
+        ++shared_called;
+
+        auto *const data = args.buffer->data_ptr_at_index<float>(0);
+        for (uint32_t frame = 0; frame < args.buffer->frame_length(); ++frame) {
+            data[frame] = static_cast<float>(args.bus_idx + 1);
+        }
+    });
+
+    auto const effect_handler = [](audio::node_render_args const &args) {
+        args.source_connections.at(0).render(args.buffer, args.time);
+    };
+
+    effect_obj_0.node->set_render_handler(effect_handler);
+    effect_obj_1.node->set_render_handler(effect_handler);
+    voice_obj.node->set_render_handler([](audio::node_render_args const &args) { args.buffer->clear(); });
+
+    mixer_obj.node->set_render_handler([](audio::node_render_args const &args) {
+        audio::pcm_buffer src_buffer{args.buffer->format(), args.buffer->frame_length()};
+
+        args.buffer->clear();
+
+        for (auto const &pair : args.source_connections) {
+            pair.second.render(&src_buffer, args.time);
+            args.buffer->add_from(src_buffer);
+        }
+    });
+
+    graph->connect(shared_obj.node, effect_obj_0.node, 0, 0, format);
+    graph->connect(shared_obj.node, effect_obj_1.node, 1, 0, format);
+    graph->connect(effect_obj_0.node, mixer_obj.node, 0, 0, format);
+    graph->connect(effect_obj_1.node, mixer_obj.node, 0, 1, format);
+    graph->connect(voice_obj.node, mixer_obj.node, 0, 2, format);
+    graph->connect(mixer_obj.node, output_obj.node, format);
+
+    audio::rendering_graph rendering_graph{output_obj.node, input_obj.node, 512,
+                                           audio::rendering_worker_pool::make_shared(3)};
+
+    auto const &plan = *rendering_graph.output_node()->plan;
+
+    // the effects pull the shared node on demand, so their steps are rendered in one task
+    XCTAssertEqual(plan.steps.size(), 3);
+    XCTAssertEqual(plan.tasks.size(), 2);
+
+    audio::pcm_buffer buffer{format, 512};
+
+    for (uint32_t cycle = 0; cycle < 10; ++cycle) {
+        audio::time const time{static_cast<int64_t>(cycle * 512), format.sample_rate()};
+
+        XCTAssertTrue(rendering_graph.output_node()->render(&buffer, time));
+
+        XCTAssertEqual(shared_called, (cycle + 1) * 2);
+        XCTAssertEqual(buffer.data_ptr_at_index<float>(0)[0], 3.0f);
+    }
+}
+
+@end
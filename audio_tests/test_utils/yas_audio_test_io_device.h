@@ -11,6 +11,7 @@ struct test_io_core : audio::io_core {
     std::optional<std::function<void(std::optional<audio::io_render_f> const &)>> set_render_handler_handler =
         std::nullopt;
     std::optional<std::function<void(uint32_t const)>> set_maximum_frames_handler = std::nullopt;
+    std::optional<std::function<void(audio::memory_policy const)>> set_memory_policy_handler = std::nullopt;
 
     std::optional<std::function<bool(void)>> start_handler = std::nullopt;
     std::optional<std::function<void(void)>> stop_handler = std::nullopt;
@@ -27,6 +28,12 @@ struct test_io_core : audio::io_core {
         }
     }
 
+    void set_memory_policy(audio::memory_policy const policy) override {
+        if (auto const &handler = this->set_memory_policy_handler) {
+            handler.value()(policy);
+        }
+    }
+
     bool start() override {
         if (auto const &handler = this->start_handler) {
             return handler.value()();
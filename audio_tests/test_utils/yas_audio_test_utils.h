@@ -21,7 +21,8 @@ bool is_equal_data(void const *const inData1, void const *const inData2, const s
 bool is_equal(AudioTimeStamp const *const ts1, AudioTimeStamp const *const ts2);
 
 struct node_object {
-    node_object(uint32_t const input_bus_count = 2, uint32_t const output_bus_count = 1);
+    node_object(uint32_t const input_bus_count = 2, uint32_t const output_bus_count = 1,
+                bool const input_prerenderable = false);
 
     audio::graph_node_ptr node;
 };
@@ -66,6 +66,14 @@ void test::fill_test_values_to_buffer(pcm_buffer &buffer) {
                         auto *ptr = buffer.data_ptr_at_index<int32_t>(buf_idx);
                         ptr[index] = value;
                     } break;
+                    case audio::pcm_format::int24: {
+                        auto *ptr = buffer.data_ptr_at_index<audio::int24_t>(buf_idx);
+                        ptr[index] = audio::to_int24(value);
+                    } break;
+                    case audio::pcm_format::float16: {
+                        auto *ptr = buffer.data_ptr_at_index<audio::float16_t>(buf_idx);
+                        ptr[index] = audio::to_float16(value);
+                    } break;
                     default:
                         break;
                 }
@@ -164,13 +172,19 @@ uint8_t const *test::data_ptr_from_buffer(pcm_buffer const &buffer, uint32_t con
             return (uint8_t const *)internal::data_ptr_from_buffer<int16_t>(buffer, channel, frame);
         case audio::pcm_format::fixed824:
             return (uint8_t const *)internal::data_ptr_from_buffer<int32_t>(buffer, channel, frame);
+        case audio::pcm_format::int24:
+            return (uint8_t const *)internal::data_ptr_from_buffer<audio::int24_t>(buffer, channel, frame);
+        case audio::pcm_format::float16:
+            return (uint8_t const *)internal::data_ptr_from_buffer<audio::float16_t>(buffer, channel, frame);
 
         default:
             throw "invalid pcm format.";
     }
 }
 
-test::node_object::node_object(uint32_t const input_bus_count, uint32_t const output_bus_count)
-    : node(audio::graph_node::make_shared(
-          audio::graph_node_args{.input_bus_count = input_bus_count, .output_bus_count = output_bus_count})) {
+test::node_object::node_object(uint32_t const input_bus_count, uint32_t const output_bus_count,
+                               bool const input_prerenderable)
+    : node(audio::graph_node::make_shared(audio::graph_node_args{.input_bus_count = input_bus_count,
+                                                                 .output_bus_count = output_bus_count,
+                                                                 .input_prerenderable = input_prerenderable})) {
 }